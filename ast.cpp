@@ -57,13 +57,17 @@ std::string ASTNode::makeLabel() const {
 
 namespace {
 
-void writeTextImpl(const ASTNode& node, std::ostream& out, int depth) {
+void writeTextLine(const ASTNode& node, std::ostream& out, int depth) {
     const std::string padding(static_cast<std::size_t>(depth) * 2U, ' ');
     out << padding << node.getType();
     if (const auto& value = node.getValue()) {
         out << ": " << *value;
     }
     out << '\n';
+}
+
+void writeTextImpl(const ASTNode& node, std::ostream& out, int depth) {
+    writeTextLine(node, out, depth);
 
     for (const auto& child : node.getChildren()) {
         if (!child) {
@@ -98,8 +102,7 @@ std::size_t assignIds(const ASTNode& node, IdMap& ids, std::size_t nextId) {
     return nextId;
 }
 
-void writeDotImpl(const ASTNode& node, std::ostream& out, const IdMap& ids) {
-    const auto nodeId = ids.at(&node);
+void writeDotNode(const ASTNode& node, std::ostream& out, std::size_t nodeId) {
     std::string label = node.getType();
     if (node.getValue()) {
         label += "\\n" + *node.getValue();
@@ -110,6 +113,11 @@ void writeDotImpl(const ASTNode& node, std::ostream& out, const IdMap& ids) {
                  '-' + std::to_string(nodeSpan.lineEnd) + ':' + std::to_string(nodeSpan.columnEnd) + ']';
     }
     out << "  node" << nodeId << " [label=\"" << escapeDotLabel(label) << "\"];\n";
+}
+
+void writeDotImpl(const ASTNode& node, std::ostream& out, const IdMap& ids) {
+    const auto nodeId = ids.at(&node);
+    writeDotNode(node, out, nodeId);
 
     for (const auto& child : node.getChildren()) {
         if (!child) {
@@ -121,6 +129,12 @@ void writeDotImpl(const ASTNode& node, std::ostream& out, const IdMap& ids) {
     }
 }
 
+void writeDotHeader(std::ostream& out) {
+    out << "digraph AST {\n";
+    out << "  rankdir=TB;\n";
+    out << "  node [shape=box];\n";
+}
+
 }  // namespace
 
 void writeText(const ASTNode& root, const std::string& filename) {
@@ -137,9 +151,7 @@ void writeDot(const ASTNode& root, const std::string& filename) {
         throw std::runtime_error("Failed to open " + filename + ".dot for writing");
     }
 
-    out << "digraph AST {\n";
-    out << "  rankdir=TB;\n";
-    out << "  node [shape=box];\n";
+    writeDotHeader(out);
 
     IdMap ids;
     assignIds(root, ids, 0);
@@ -148,4 +160,46 @@ void writeDot(const ASTNode& root, const std::string& filename) {
     out << "}\n";
 }
 
+StreamWriter::StreamWriter(const ASTNode& root, const std::string& filename, bool withText, bool withDot) {
+    if (withText) {
+        text.open(filename + ".outast");
+        if (!text) {
+            throw std::runtime_error("Failed to open " + filename + ".outast for writing");
+        }
+        writeTextLine(root, text, 0);
+    }
+    if (withDot) {
+        dot.open(filename + ".dot");
+        if (!dot) {
+            throw std::runtime_error("Failed to open " + filename + ".dot for writing");
+        }
+        writeDotHeader(dot);
+        writeDotNode(root, dot, 0);
+    }
+}
+
+void StreamWriter::writeChild(const ASTNode& child) {
+    if (text.is_open()) {
+        writeTextImpl(child, text, 1);
+    }
+    if (dot.is_open()) {
+        // Ids continue the preorder numbering writeDot would have used.
+        IdMap ids;
+        const std::size_t afterChild = assignIds(child, ids, nextId);
+        dot << "  node0 -> node" << nextId << ";\n";
+        writeDotImpl(child, dot, ids);
+        nextId = afterChild;
+    }
+}
+
+void StreamWriter::finish() {
+    if (dot.is_open()) {
+        dot << "}\n";
+        dot.flush();
+    }
+    if (text.is_open()) {
+        text.flush();
+    }
+}
+
 }  // namespace ast
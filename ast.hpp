@@ -11,9 +11,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace ast {
@@ -25,6 +29,10 @@ struct SourceSpan {
     int columnEnd{0};
 };
 
+// Parsed value of an IntLiteral / FloatLiteral; monostate for other nodes
+// and for literals too large for int64 / double.
+using NumericValue = std::variant<std::monostate, std::int64_t, double>;
+
 class ASTNode {
 public:
     using Ptr = std::shared_ptr<ASTNode>;
@@ -41,6 +49,8 @@ public:
     [[nodiscard]] const std::optional<std::string>& getValue() const noexcept { return value; }
     [[nodiscard]] const std::optional<SourceSpan>& getSourceSpan() const noexcept { return span; }
     [[nodiscard]] const std::vector<Ptr>& getChildren() const noexcept { return children; }
+    [[nodiscard]] const NumericValue& getNumericValue() const noexcept { return number; }
+    void setNumericValue(NumericValue v) { number = v; }
 
 private:
     [[nodiscard]] std::string makeLabel() const;
@@ -49,9 +59,27 @@ private:
     std::optional<std::string> value;
     std::optional<SourceSpan> span;
     std::vector<Ptr> children;
+    NumericValue number;
 };
 
 void writeText(const ASTNode& root, const std::string& filename);
 void writeDot(const ASTNode& root, const std::string& filename);
 
+// Writes <filename>.outast and <filename>.dot for a root whose children are
+// handed over one at a time (streaming mode), so each can be released once
+// written. The files are identical to writeText/writeDot on the whole tree.
+// Either file can be left out.
+class StreamWriter {
+public:
+    StreamWriter(const ASTNode& root, const std::string& filename, bool withText = true, bool withDot = true);
+
+    void writeChild(const ASTNode& child);
+    void finish();
+
+private:
+    std::ofstream text;
+    std::ofstream dot;
+    std::size_t nextId{1};
+};
+
 }  // namespace ast
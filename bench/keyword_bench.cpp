@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: keyword_bench.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Microbenchmark: keyword recognition through the old KEYWORDS
+// unordered_set (string built per identifier, as readIdentifier used to do)
+// versus the compile-time perfect hash behind keywordKind().
+//
+//   g++ -std=c++17 -O2 -I./include bench/keyword_bench.cpp include/lexer_support.cpp -o keyword_bench
+//   ./keyword_bench test-files/*.src
+
+#include "lexer_support.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Identifier-shaped words of every source file, in token order.
+vector<string> collectWords(int argc, char** argv) {
+    vector<string> words;
+    for (int a = 1; a < argc; ++a) {
+        ifstream in(argv[a], ios::binary);
+        if (!in) {
+            cerr << "Cannot open: " << argv[a] << "\n";
+            continue;
+        }
+        const string text(istreambuf_iterator<char>(in), istreambuf_iterator<char>{});
+        Lexer lx;
+        lx.src = text;
+        for (Token t = lx.nextToken(); t.kind != TokenKind::Eof; t = lx.nextToken()) {
+            if (t.kind == TokenKind::Id || isKeywordKind(t.kind)) {
+                words.emplace_back(lx.lexeme(t));
+            }
+        }
+    }
+    return words;
+}
+
+template <typename Fn>
+double nsPerLookup(const vector<string>& words, int rounds, size_t& hits, Fn&& isKeyword) {
+    hits = 0;
+    const auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto& w : words) {
+            hits += isKeyword(string_view(w)) ? 1 : 0;
+        }
+    }
+    const auto t1 = chrono::steady_clock::now();
+    const double ns = chrono::duration<double, nano>(t1 - t0).count();
+    return ns / (static_cast<double>(words.size()) * rounds);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./keyword_bench <source.src>...\n";
+        return 1;
+    }
+    const vector<string> words = collectWords(argc, argv);
+    if (words.empty()) {
+        cerr << "No identifiers found.\n";
+        return 1;
+    }
+
+    for (int k = 0; k < kKeywordCount; ++k) {
+        const string_view kw = tokenKindName(static_cast<TokenKind>(k));
+        if (keywordKind(kw) != static_cast<TokenKind>(k) || !KEYWORDS.count(string(kw))) {
+            cerr << "[FAIL] keyword \"" << kw << "\" not recognised\n";
+            return 2;
+        }
+    }
+
+    const int rounds = static_cast<int>(max<size_t>(1, 20000000 / words.size()));
+    size_t setHits = 0, hashHits = 0;
+    const double setNs = nsPerLookup(words, rounds, setHits, [](string_view w) {
+        return KEYWORDS.count(string(w)) != 0;
+    });
+    const double hashNs = nsPerLookup(words, rounds, hashHits, [](string_view w) {
+        return keywordKind(w) != TokenKind::Id;
+    });
+    if (setHits != hashHits) {
+        cerr << "[FAIL] lookups disagree: set=" << setHits << " hash=" << hashHits << "\n";
+        return 2;
+    }
+
+    cout << "words:            " << words.size() << " (x" << rounds << " rounds)\n";
+    cout << "unordered_set:    " << setNs << " ns/lookup\n";
+    cout << "perfect hash:     " << hashNs << " ns/lookup\n";
+    cout << "speedup:          " << setNs / hashNs << "x\n";
+    return 0;
+}
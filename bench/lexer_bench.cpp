@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: lexer_bench.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Lexer benchmark: hand-written Lexer::nextToken versus the table-driven
+// Lexer::nextTokenDfa. Both token streams are compared field by field
+// before anything is timed.
+//
+//   g++ -std=c++17 -O2 -I./include bench/lexer_bench.cpp include/lexer_support.cpp bench/lexer_dfa.cpp -o lexer_bench
+//   ./lexer_bench test-files/*.src
+
+#include "lexer_support.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct SourceFile {
+    string path;
+    string text;
+};
+
+using NextFn = Token (Lexer::*)();
+
+vector<Token> lexAll(const string& text, NextFn next) {
+    Lexer lx;
+    lx.src = text;
+    vector<Token> out;
+    do {
+        out.push_back((lx.*next)());
+    } while (out.back().kind != TokenKind::Eof);
+    return out;
+}
+
+bool sameToken(const Token& a, const Token& b) {
+    return a.kind == b.kind && a.offset == b.offset && a.length == b.length;
+}
+
+// Best-of-`rounds` wall time to lex every file once, in milliseconds.
+double timeCorpus(const vector<SourceFile>& files, NextFn next, int rounds, size_t& tokens) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        tokens = 0;
+        const auto t0 = chrono::steady_clock::now();
+        for (const auto& f : files) {
+            Lexer lx;
+            lx.src = f.text;
+            while ((lx.*next)().kind != TokenKind::Eof) {
+                ++tokens;
+            }
+        }
+        const auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./lexer_bench <source.src>...\n";
+        return 1;
+    }
+    vector<SourceFile> files;
+    size_t bytes = 0;
+    for (int a = 1; a < argc; ++a) {
+        ifstream in(argv[a], ios::binary);
+        if (!in) {
+            cerr << "Cannot open: " << argv[a] << "\n";
+            return 1;
+        }
+        files.push_back({argv[a], string(istreambuf_iterator<char>(in), istreambuf_iterator<char>())});
+        bytes += files.back().text.size();
+    }
+
+    for (const auto& f : files) {
+        const auto hand = lexAll(f.text, &Lexer::nextToken);
+        const auto dfa = lexAll(f.text, &Lexer::nextTokenDfa);
+        const size_t common = min(hand.size(), dfa.size());
+        for (size_t k = 0; k < common; ++k) {
+            if (!sameToken(hand[k], dfa[k])) {
+                LineIndex lines;
+                lines.extend(f.text);
+                const SourcePos pos = lines.at(hand[k].offset);
+                cerr << "[FAIL] " << f.path << ": token " << k << " differs at " << pos.line << ':'
+                     << pos.col << " (" << tokenKindName(hand[k].kind) << " vs "
+                     << tokenKindName(dfa[k].kind) << ")\n";
+                return 2;
+            }
+        }
+        if (hand.size() != dfa.size()) {
+            cerr << "[FAIL] " << f.path << ": " << hand.size() << " vs " << dfa.size() << " tokens\n";
+            return 2;
+        }
+    }
+    cout << "token streams identical on " << files.size() << " file(s)\n";
+
+    // Repeat the corpus so small test files still give a measurable time.
+    const int rounds = static_cast<int>(max<size_t>(5, 50000000 / max<size_t>(bytes, 1)));
+    size_t tokens = 0;
+    const double handMs = timeCorpus(files, &Lexer::nextToken, rounds, tokens);
+    const double dfaMs = timeCorpus(files, &Lexer::nextTokenDfa, rounds, tokens);
+    const double mb = static_cast<double>(bytes) / 1e6;
+
+    cout << "corpus:           " << bytes << " bytes, " << tokens << " tokens (best of " << rounds << ")\n";
+    cout << "nextToken:        " << handMs << " ms, " << mb / (handMs / 1e3) << " MB/s, "
+         << tokens / (handMs / 1e3) / 1e6 << " Mtok/s\n";
+    cout << "nextTokenDfa:     " << dfaMs << " ms, " << mb / (dfaMs / 1e3) << " MB/s, "
+         << tokens / (dfaMs / 1e3) / 1e6 << " Mtok/s\n";
+    return 0;
+}
@@ -0,0 +1,311 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: lexer_dfa.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Table-driven alternative to Lexer::nextToken. The character-class table
+// and the transition table are both computed by constexpr code from the
+// token set below, so adding an operator means adding one FIXED_TOKENS row.
+//
+// Every DFA state is accepting (each prefix of a token is itself a token:
+// "<" for "<=", "1." for "1.5", ...), so scanning is plain maximal munch
+// with no backtracking: follow transitions until there is none and return
+// the kind of the last state. Nested block comments are not regular; the
+// "/*" state hands over to readBlockComment, as a generated lexer would
+// hand over to an action.
+//
+// Built only by bench/lexer_bench.cpp: at one transition per byte it stays
+// behind nextToken's SIMD scans, so the parser does not use it.
+
+#include "lexer_support.h"
+#include "lexer_scan.h"
+
+#include <cstdint>
+
+using namespace std;
+
+namespace {
+
+enum class DfaAction : uint8_t { None, LineComment, NestedComment };
+
+struct FixedToken {
+    const char* spelling;
+    TokenKind kind;
+    DfaAction action;
+};
+
+// Tokens with a fixed spelling, exactly the set nextToken() recognises.
+constexpr FixedToken FIXED_TOKENS[] = {
+    {"==", TokenKind::Eq, DfaAction::None},
+    {"<>", TokenKind::NotEq, DfaAction::None},
+    {"<=", TokenKind::Leq, DfaAction::None},
+    {">=", TokenKind::Geq, DfaAction::None},
+    {"=>", TokenKind::ReturnType, DfaAction::None},
+    {"::", TokenKind::ScopeOp, DfaAction::None},
+    {"+", TokenKind::Plus, DfaAction::None},
+    {"-", TokenKind::Minus, DfaAction::None},
+    {"*", TokenKind::Mult, DfaAction::None},
+    {"/", TokenKind::Div, DfaAction::None},
+    {"(", TokenKind::OpenPar, DfaAction::None},
+    {")", TokenKind::ClosePar, DfaAction::None},
+    {"[", TokenKind::OpenSqbr, DfaAction::None},
+    {"]", TokenKind::CloseSqbr, DfaAction::None},
+    {"{", TokenKind::OpenCubr, DfaAction::None},
+    {"}", TokenKind::CloseCubr, DfaAction::None},
+    {";", TokenKind::Semi, DfaAction::None},
+    {",", TokenKind::Comma, DfaAction::None},
+    {":", TokenKind::Colon, DfaAction::None},
+    {".", TokenKind::Dot, DfaAction::None},
+    {"<", TokenKind::Lt, DfaAction::None},
+    {">", TokenKind::Gt, DfaAction::None},
+    {"=", TokenKind::Assign, DfaAction::None},
+    {"//", TokenKind::InlineCmt, DfaAction::LineComment},
+    {"/*", TokenKind::BlockCmt, DfaAction::NestedComment},
+};
+
+// Classes every token family needs; each distinct character of a fixed
+// spelling then gets a class of its own.
+enum BaseClass : uint8_t {
+    CC_OTHER, CC_NEWLINE, CC_LETTER, CC_LETTER_E, CC_UNDERSCORE, CC_ZERO, CC_DIGIT,
+    CC_BASE_COUNT
+};
+
+constexpr int kMaxClasses = 32;
+constexpr int kMaxStates = 64;
+constexpr uint8_t kDead = 0xFF;
+
+// Named states for identifiers and numbers; fixed-spelling states follow.
+enum NamedState : uint8_t {
+    S_START, S_INVALID_CHAR, S_ID, S_BAD_ID,
+    S_INT_ZERO, S_INT, S_INT_LEADING_ZERO,
+    S_FRAC_EMPTY, S_FRAC_ZERO, S_FRAC_NONZERO_END, S_FRAC_ZERO_END,
+    S_EXP_START, S_EXP_SIGN, S_EXP_ZERO, S_EXP_NONZERO, S_EXP_LEADING_ZERO,
+    S_BAD_FRAC, S_BAD_EXP_START, S_BAD_EXP_SIGN, S_BAD_EXP_DIGITS,
+    S_NUM_SUFFIX,
+    S_NAMED_COUNT
+};
+
+struct Dfa {
+    uint8_t charClass[256];
+    uint8_t next[kMaxStates][kMaxClasses];
+    TokenKind accept[kMaxStates];
+    DfaAction action[kMaxStates];
+    int classes;
+    int states;
+};
+
+constexpr Dfa buildDfa() {
+    Dfa d{};
+
+    // ---- character classes
+    for (int c = 0; c < 256; ++c) d.charClass[c] = CC_OTHER;
+    for (int c = 'a'; c <= 'z'; ++c) d.charClass[c] = CC_LETTER;
+    for (int c = 'A'; c <= 'Z'; ++c) d.charClass[c] = CC_LETTER;
+    d.charClass[static_cast<unsigned char>('e')] = CC_LETTER_E;
+    d.charClass[static_cast<unsigned char>('E')] = CC_LETTER_E;
+    d.charClass[static_cast<unsigned char>('_')] = CC_UNDERSCORE;
+    d.charClass[static_cast<unsigned char>('0')] = CC_ZERO;
+    for (int c = '1'; c <= '9'; ++c) d.charClass[c] = CC_DIGIT;
+    d.charClass[static_cast<unsigned char>('\n')] = CC_NEWLINE;
+    d.classes = CC_BASE_COUNT;
+    for (const auto& tok : FIXED_TOKENS) {
+        for (const char* p = tok.spelling; *p; ++p) {
+            auto& cls = d.charClass[static_cast<unsigned char>(*p)];
+            if (cls == CC_OTHER) cls = static_cast<uint8_t>(d.classes++);
+        }
+    }
+    const uint8_t ccDot = d.charClass[static_cast<unsigned char>('.')];
+    const uint8_t ccPlus = d.charClass[static_cast<unsigned char>('+')];
+    const uint8_t ccMinus = d.charClass[static_cast<unsigned char>('-')];
+
+    // ---- states
+    for (int s = 0; s < kMaxStates; ++s) {
+        for (int c = 0; c < kMaxClasses; ++c) d.next[s][c] = kDead;
+        d.accept[s] = TokenKind::InvalidNum;
+        d.action[s] = DfaAction::None;
+    }
+    d.states = S_NAMED_COUNT;
+
+    auto on = [&d](uint8_t from, uint8_t cls, uint8_t to) { d.next[from][cls] = to; };
+    auto onDigits = [&](uint8_t from, uint8_t zeroTo, uint8_t digitTo) {
+        on(from, CC_ZERO, zeroTo);
+        on(from, CC_DIGIT, digitTo);
+    };
+    // Letters and '_' glued to a number are swallowed into an invalid
+    // number (digits after them are not).
+    auto onSuffix = [&](uint8_t from) {
+        on(from, CC_LETTER, S_NUM_SUFFIX);
+        on(from, CC_LETTER_E, S_NUM_SUFFIX);
+        on(from, CC_UNDERSCORE, S_NUM_SUFFIX);
+    };
+
+    // Anything without a rule is a one-byte invalid character.
+    for (int c = 0; c < d.classes; ++c) on(S_START, static_cast<uint8_t>(c), S_INVALID_CHAR);
+    d.accept[S_INVALID_CHAR] = TokenKind::InvalidChar;
+
+    // identifiers / keywords, and the invalid "_..." form
+    on(S_START, CC_LETTER, S_ID);
+    on(S_START, CC_LETTER_E, S_ID);
+    on(S_START, CC_UNDERSCORE, S_BAD_ID);
+    for (uint8_t s : {uint8_t(S_ID), uint8_t(S_BAD_ID)}) {
+        for (uint8_t c : {uint8_t(CC_LETTER), uint8_t(CC_LETTER_E), uint8_t(CC_UNDERSCORE),
+                          uint8_t(CC_ZERO), uint8_t(CC_DIGIT)}) {
+            on(s, c, s);
+        }
+    }
+    d.accept[S_ID] = TokenKind::Id;
+    d.accept[S_BAD_ID] = TokenKind::InvalidId;
+
+    // numbers: intnum  = 0 | [1-9][0-9]*
+    //          floatnum = intnum . (0 | [0-9]*[1-9]) (e [+-]? intnum)?
+    // scanned greedily in the shape readNumberGreedyAndValidate uses, with
+    // the validity of what was seen so far folded into the state.
+    onDigits(S_START, S_INT_ZERO, S_INT);
+    onDigits(S_INT_ZERO, S_INT_LEADING_ZERO, S_INT_LEADING_ZERO);
+    onDigits(S_INT, S_INT, S_INT);
+    onDigits(S_INT_LEADING_ZERO, S_INT_LEADING_ZERO, S_INT_LEADING_ZERO);
+    on(S_INT_ZERO, ccDot, S_FRAC_EMPTY);
+    on(S_INT, ccDot, S_FRAC_EMPTY);
+    on(S_INT_LEADING_ZERO, ccDot, S_BAD_FRAC);
+    d.accept[S_INT_ZERO] = TokenKind::IntNum;
+    d.accept[S_INT] = TokenKind::IntNum;
+
+    onDigits(S_FRAC_EMPTY, S_FRAC_ZERO, S_FRAC_NONZERO_END);
+    onDigits(S_FRAC_ZERO, S_FRAC_ZERO_END, S_FRAC_NONZERO_END);
+    onDigits(S_FRAC_NONZERO_END, S_FRAC_ZERO_END, S_FRAC_NONZERO_END);
+    onDigits(S_FRAC_ZERO_END, S_FRAC_ZERO_END, S_FRAC_NONZERO_END);
+    on(S_FRAC_EMPTY, CC_LETTER_E, S_BAD_EXP_START);
+    on(S_FRAC_ZERO, CC_LETTER_E, S_EXP_START);
+    on(S_FRAC_NONZERO_END, CC_LETTER_E, S_EXP_START);
+    on(S_FRAC_ZERO_END, CC_LETTER_E, S_BAD_EXP_START);
+    d.accept[S_FRAC_ZERO] = TokenKind::FloatNum;
+    d.accept[S_FRAC_NONZERO_END] = TokenKind::FloatNum;
+
+    on(S_EXP_START, ccPlus, S_EXP_SIGN);
+    on(S_EXP_START, ccMinus, S_EXP_SIGN);
+    onDigits(S_EXP_START, S_EXP_ZERO, S_EXP_NONZERO);
+    onDigits(S_EXP_SIGN, S_EXP_ZERO, S_EXP_NONZERO);
+    onDigits(S_EXP_ZERO, S_EXP_LEADING_ZERO, S_EXP_LEADING_ZERO);
+    onDigits(S_EXP_NONZERO, S_EXP_NONZERO, S_EXP_NONZERO);
+    onDigits(S_EXP_LEADING_ZERO, S_EXP_LEADING_ZERO, S_EXP_LEADING_ZERO);
+    d.accept[S_EXP_ZERO] = TokenKind::FloatNum;
+    d.accept[S_EXP_NONZERO] = TokenKind::FloatNum;
+
+    onDigits(S_BAD_FRAC, S_BAD_FRAC, S_BAD_FRAC);
+    on(S_BAD_FRAC, CC_LETTER_E, S_BAD_EXP_START);
+    on(S_BAD_EXP_START, ccPlus, S_BAD_EXP_SIGN);
+    on(S_BAD_EXP_START, ccMinus, S_BAD_EXP_SIGN);
+    onDigits(S_BAD_EXP_START, S_BAD_EXP_DIGITS, S_BAD_EXP_DIGITS);
+    onDigits(S_BAD_EXP_SIGN, S_BAD_EXP_DIGITS, S_BAD_EXP_DIGITS);
+    onDigits(S_BAD_EXP_DIGITS, S_BAD_EXP_DIGITS, S_BAD_EXP_DIGITS);
+
+    for (uint8_t s = S_INT_ZERO; s <= S_NUM_SUFFIX; ++s) {
+        // LETTER_E transitions set above take precedence over the suffix.
+        const uint8_t keepE = d.next[s][CC_LETTER_E];
+        onSuffix(s);
+        if (keepE != kDead) on(s, CC_LETTER_E, keepE);
+    }
+
+    // ---- fixed spellings as a trie hanging off START
+    for (const auto& tok : FIXED_TOKENS) {
+        uint8_t s = S_START;
+        for (const char* p = tok.spelling; *p; ++p) {
+            const uint8_t cls = d.charClass[static_cast<unsigned char>(*p)];
+            uint8_t t = d.next[s][cls];
+            if (t == kDead || t < S_NAMED_COUNT) {   // START's default is S_INVALID_CHAR
+                t = static_cast<uint8_t>(d.states++);
+                on(s, cls, t);
+            }
+            s = t;
+        }
+        d.accept[s] = tok.kind;
+        d.action[s] = tok.action;
+    }
+    return d;
+}
+
+constexpr Dfa DFA = buildDfa();
+static_assert(DFA.classes <= kMaxClasses, "too many character classes for the DFA table");
+static_assert(DFA.states <= kMaxStates, "too many states for the DFA table");
+
+// The scanning loop's form of DFA.next: one row of kMaxClasses entries per
+// state, each entry the offset of the target state's row (state *
+// kMaxClasses), or kStop. The comment openers have no transitions out, so
+// the loop never needs to look at a state's action.
+constexpr uint16_t kStop = 0xFFFF;
+
+struct FlatDfa {
+    uint16_t next[kMaxStates * kMaxClasses];
+};
+
+constexpr FlatDfa flattenDfa() {
+    FlatDfa f{};
+    for (int s = 0; s < kMaxStates; ++s) {
+        for (int c = 0; c < kMaxClasses; ++c) {
+            const uint8_t t = DFA.next[s][c];
+            f.next[s * kMaxClasses + c] = t == kDead ? kStop : static_cast<uint16_t>(t * kMaxClasses);
+        }
+    }
+    return f;
+}
+
+constexpr FlatDfa FLAT = flattenDfa();
+
+constexpr bool actionStatesAreFinal() {
+    for (int s = 0; s < DFA.states; ++s) {
+        if (DFA.action[s] == DfaAction::None) continue;
+        for (int c = 0; c < kMaxClasses; ++c) {
+            if (DFA.next[s][c] != kDead) return false;
+        }
+    }
+    return true;
+}
+static_assert(actionStatesAreFinal(), "a comment opener must end its token");
+
+}  // namespace
+
+Token Lexer::nextTokenDfa() {
+    skipWhitespace();
+    if (atEnd()) return make(TokenKind::Eof, i);
+
+    const size_t start = i;
+    const char* s = src.data();
+    const size_t n = src.size();
+
+    // One class lookup and one transition per byte.
+    uint32_t row = S_START * kMaxClasses;
+    size_t p = i;
+    while (p < n) {
+        const uint16_t next = FLAT.next[row + DFA.charClass[static_cast<unsigned char>(s[p])]];
+        if (next == kStop) break;
+        row = next;
+        ++p;
+    }
+    const uint32_t state = row / kMaxClasses;
+
+    switch (DFA.action[state]) {
+    case DfaAction::LineComment:
+        advanceTo(lexscan::findNewline(s, p, n));
+        return make(TokenKind::InlineCmt, start);
+    case DfaAction::NestedComment:
+        return readBlockComment();
+    case DfaAction::None:
+        break;
+    }
+
+    advanceTo(p);
+    const TokenKind kind = DFA.accept[state];
+    if (kind == TokenKind::Id) {
+        return make(keywordKind(src.substr(start, p - start)), start);
+    }
+    if (kind == TokenKind::IntNum || kind == TokenKind::FloatNum) {
+        return makeNumber(kind, start);
+    }
+    return make(kind, start);
+}
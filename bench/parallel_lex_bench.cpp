@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parallel_lex_bench.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Parallel lexing benchmark: serial Lexer::nextToken versus lexParallel on
+// one large buffer (the given files concatenated, repeated up to ~64 MB).
+// Before timing, lexParallel is checked against the serial stream with
+// small forced chunks, so chunk boundaries land inside comments.
+//
+//   g++ -std=c++17 -O2 -pthread -I./include bench/parallel_lex_bench.cpp include/lexer_support.cpp include/lexer_parallel.cpp -o parallel_lex_bench
+//   ./parallel_lex_bench test-files/*.src
+
+#include "lexer_support.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+vector<Token> lexSerial(string_view text) {
+    Lexer lx;
+    lx.src = text;
+    vector<Token> out;
+    do {
+        out.push_back(lx.nextToken());
+    } while (out.back().kind != TokenKind::Eof);
+    return out;
+}
+
+bool sameStream(const vector<Token>& a, const vector<Token>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t k = 0; k < a.size(); ++k) {
+        if (a[k].kind != b[k].kind || a[k].offset != b[k].offset || a[k].length != b[k].length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Fn>
+double bestMs(int rounds, Fn fn) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        const auto t0 = chrono::steady_clock::now();
+        fn();
+        const auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./parallel_lex_bench <source.src>...\n";
+        return 1;
+    }
+    string corpus;
+    for (int a = 1; a < argc; ++a) {
+        ifstream in(argv[a], ios::binary);
+        if (!in) {
+            cerr << "Cannot open: " << argv[a] << "\n";
+            return 1;
+        }
+        const string text((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+
+        const auto serial = lexSerial(text);
+        for (size_t minChunk : {1, 16, 256}) {
+            if (!sameStream(serial, lexParallel(text, 8, minChunk))) {
+                cerr << "[FAIL] " << argv[a] << ": parallel tokens differ (min chunk " << minChunk << ")\n";
+                return 2;
+            }
+        }
+        corpus += text;
+        corpus += '\n';
+    }
+    cout << "parallel token streams identical on " << argc - 1 << " file(s)\n";
+
+    const string unit = corpus;
+    while (corpus.size() < (size_t(64) << 20)) {
+        corpus += unit;
+    }
+    const double mb = static_cast<double>(corpus.size()) / 1e6;
+
+    size_t tokens = 0;
+    const double serialMs = bestMs(3, [&] { tokens = lexSerial(corpus).size(); });
+    cout << "corpus:           " << corpus.size() << " bytes, " << tokens << " tokens\n";
+    cout << "serial:           " << serialMs << " ms, " << mb / (serialMs / 1e3) << " MB/s\n";
+
+    const unsigned hw = max(1u, thread::hardware_concurrency());
+    for (unsigned threads = 2; threads <= max(2u, hw); threads *= 2) {
+        vector<Token> par;
+        const double ms = bestMs(3, [&] { par = lexParallel(corpus, threads); });
+        if (par.size() != tokens) {
+            cerr << "[FAIL] " << threads << " threads: " << par.size() << " tokens\n";
+            return 2;
+        }
+        cout << threads << " threads:" << string(threads < 10 ? 10 : 9, ' ') << ms << " ms, "
+             << mb / (ms / 1e3) << " MB/s (" << serialMs / ms << "x)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,275 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parse_table_bench.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Parse-table benchmark. Compares the memory of three table layouts and
+// the cost of the LL(1) loop's per-step work with each:
+//  - the old string layout: string stack, linear termIndex/nontermIndex
+//    scans, RHS copied out of vector<vector<vector<string>>>, and an
+//    "@ACTION<k>" marker per expansion that is parsed back with stoi;
+//  - a dense row-major int16 matrix with a stack of tagged 32-bit entries
+//    (StackEntry), right-hand sides appended from a pre-tagged pool;
+//  - the comb-vector table Table::predict uses, with the same stack.
+// It also times random single-cell lookups in the two integer layouts.
+// All recognisers run the plain table (no lookahead heuristics, errors
+// recovered by popping, restarting from START while input is left) over
+// each file's tokens. Their expansion traces are compared before anything
+// is timed.
+//
+//   g++ -std=c++17 -O2 -I./include bench/parse_table_bench.cpp parse_table.cpp parse_table_embedded.cpp source_buffer.cpp include/lexer_support.cpp -o parse_table_bench
+//   ./parse_table_bench test-files/test-6.17-complex-expressions.src
+
+#include "../parse_table.hpp"
+#include "../source_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// The table as Table::map stored it before symbols were interned.
+struct StringTable {
+    vector<string> terms;
+    vector<string> nonterms;
+    vector<vector<vector<string>>> map;
+};
+
+StringTable toStrings(const Table& T) {
+    StringTable S;
+    S.terms.assign(T.symbols.begin(), T.symbols.begin() + T.termCount);
+    S.nonterms.assign(T.symbols.begin() + T.termCount, T.symbols.begin() + T.termCount + T.nontermCount);
+    for (int A = T.termCount; A < T.termCount + T.nontermCount; ++A) {
+        vector<vector<string>> row(S.terms.size());
+        for (int a = 0; a < T.termCount; ++a) {
+            const int p = T.predict(A, a);
+            if (p >= 0) row[a] = T.rhs(p).strings();
+        }
+        S.map.push_back(move(row));
+    }
+    return S;
+}
+
+int termIndexScan(const StringTable& S, const string& a) {
+    for (int j = 0; j < (int)S.terms.size(); ++j) if (S.terms[j] == a) return j;
+    return -1;
+}
+int nontermIndexScan(const StringTable& S, const string& A) {
+    for (int i = 0; i < (int)S.nonterms.size(); ++i) if (S.nonterms[i] == A) return i;
+    return -1;
+}
+
+// Where the recognisers put decoded action indices, so the decoding stays.
+volatile size_t actionSink = 0;
+
+// Returns the number of steps; `trace` (if set) gets every expansion's RHS.
+size_t recognizeStrings(const StringTable& S, const vector<string>& input,
+                        vector<vector<string>>* trace) {
+    vector<string> stack{"$", "START"};
+    size_t ip = 0, steps = 0, restartedAt = 0, expansions = 0;
+    while (!stack.empty()) {
+        const string X = stack.back();
+        stack.pop_back();
+        ++steps;
+        const string& a = input[min(ip, input.size() - 1)];
+        if (X.rfind("@ACTION", 0) == 0) {
+            actionSink = actionSink + static_cast<size_t>(stoi(X.substr(7)));   // the driver runs frame k here
+            continue;
+        }
+        if (X == "$") {
+            if (ip + 1 >= input.size()) break;
+            if (ip == restartedAt) ++ip;   // START made no progress: drop a token
+            restartedAt = ip;
+            stack = {"$", "START"};
+            continue;
+        }
+        if (nontermIndexScan(S, X) < 0) {
+            ++ip;   // match, or skip the token as the driver's recovery does
+            continue;
+        }
+        const int i = nontermIndexScan(S, X);
+        const int j = termIndexScan(S, a);
+        if (j < 0 || S.map[i][j].empty()) continue;
+        const vector<string> rhs = S.map[i][j];
+        if (trace) trace->push_back(rhs);
+        stack.push_back("@ACTION" + to_string(expansions++));
+        if (!(rhs.size() == 1 && rhs[0] == "EPSILON")) {
+            for (int k = static_cast<int>(rhs.size()) - 1; k >= 0; --k) stack.push_back(rhs[k]);
+        }
+    }
+    return steps;
+}
+
+size_t stringTableBytes(const StringTable& S) {
+    size_t bytes = sizeof(S) + (S.terms.capacity() + S.nonterms.capacity()) * sizeof(string);
+    for (const auto& name : S.terms) bytes += name.capacity() > 15 ? name.capacity() + 1 : 0;
+    for (const auto& name : S.nonterms) bytes += name.capacity() > 15 ? name.capacity() + 1 : 0;
+    for (const auto& row : S.map) {
+        bytes += sizeof(row) + row.capacity() * sizeof(vector<string>);
+        for (const auto& cell : row) {
+            bytes += cell.capacity() * sizeof(string);
+            for (const auto& sym : cell) bytes += sym.capacity() > 15 ? sym.capacity() + 1 : 0;
+        }
+    }
+    return bytes;
+}
+
+// `predict(A, a)` returns the production for nonterminal symbol A on a.
+template <typename Predict>
+size_t recognizeIds(const Table& T, Predict predict, const vector<int>& input,
+                    vector<vector<string>>* trace) {
+    const vector<StackEntry> initial{T.stackEntry(T.ids.eof), T.stackEntry(T.symbolId("START"))};
+    vector<StackEntry> stack = initial;
+    size_t ip = 0, steps = 0, restartedAt = 0, expansions = 0;
+    while (!stack.empty()) {
+        const StackEntry top = stack.back();
+        stack.pop_back();
+        ++steps;
+        if (top.tag() == StackTag::Action) {
+            actionSink = actionSink + static_cast<size_t>(top.payload());
+            continue;
+        }
+        const int X = top.payload();
+        const int a = input[min(ip, input.size() - 1)];
+        if (X == T.ids.eof) {
+            if (ip + 1 >= input.size()) break;
+            if (ip == restartedAt) ++ip;
+            restartedAt = ip;
+            stack = initial;
+            continue;
+        }
+        if (top.tag() == StackTag::Terminal) {
+            ++ip;
+            continue;
+        }
+        const int p = predict(X, a);
+        if (p < 0) continue;
+        if (trace) trace->push_back(T.rhs(p).strings());
+        stack.push_back(StackEntry::make(StackTag::Action, static_cast<int>(expansions++)));
+        stack.insert(stack.end(), T.prodEntries.begin() + T.prodStart[p], T.prodEntries.begin() + T.prodStart[p + 1]);
+    }
+    return steps;
+}
+
+template <typename Fn>
+double bestMs(int rounds, Fn fn) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        const auto t0 = chrono::steady_clock::now();
+        fn();
+        const auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./parse_table_bench <source.src>...\n";
+        return 1;
+    }
+    const Table T = loadEmbeddedTable();
+    const StringTable S = toStrings(T);
+    vector<int16_t> dense;
+    for (int A = T.termCount; A < T.termCount + T.nontermCount; ++A) {
+        for (int a = 0; a < T.termCount; ++a) dense.push_back(static_cast<int16_t>(T.predict(A, a)));
+    }
+    auto predictDense = [&](int A, int a) {
+        return static_cast<int>(dense[static_cast<size_t>(A - T.termCount) * T.termCount + a]);
+    };
+    auto predictComb = [&](int A, int a) { return T.predict(A, a); };
+
+    int epsilonDefaults = 0;
+    for (int r = 0; r < T.nontermCount; ++r) {
+        const int p = T.cells.defaultOf(r);
+        epsilonDefaults += (p >= 0 && T.isEpsilon(p));
+    }
+    cout << "table: " << T.nontermCount << " x " << T.termCount << ", " << T.productionCount()
+         << " productions\n";
+    cout << "  string table: " << stringTableBytes(S) << " bytes\n";
+    cout << "  dense int16:  " << dense.size() * sizeof(int16_t) << " bytes\n";
+    cout << "  comb vector:  " << T.cells.bytes() << " bytes (" << T.cells.storedEntries()
+         << " non-default cells in " << T.cells.slots() << " slots; " << epsilonDefaults
+         << " rows default to epsilon)\n";
+
+    // Random single lookups, the same (A, a) sequence for both layouts.
+    {
+        vector<pair<int, int>> probes;
+        uint32_t seed = 12345;
+        for (int k = 0; k < 1 << 16; ++k) {
+            seed = seed * 1664525u + 1013904223u;
+            probes.emplace_back(T.termCount + static_cast<int>((seed >> 8) % T.nontermCount),
+                                static_cast<int>((seed >> 20) % T.termCount));
+        }
+        long checkDense = 0, checkComb = 0;
+        const double denseMs = bestMs(50, [&] { for (auto [A, a] : probes) checkDense += predictDense(A, a); });
+        const double combMs = bestMs(50, [&] { for (auto [A, a] : probes) checkComb += predictComb(A, a); });
+        if (checkDense != checkComb) {
+            cerr << "[FAIL] dense and comb lookups differ\n";
+            return 2;
+        }
+        cout << "random lookup: dense " << denseMs * 1e6 / probes.size() << " ns, comb "
+             << combMs * 1e6 / probes.size() << " ns\n";
+    }
+
+    for (int f = 1; f < argc; ++f) {
+        io::SourceBuffer src;
+        try {
+            src = io::SourceBuffer::open(argv[f]);
+        } catch (const exception& ex) {
+            cerr << "Cannot open: " << argv[f] << " (" << ex.what() << ")\n";
+            return 1;
+        }
+        Lexer lx;
+        lx.src = src.view();
+        vector<int> ids;
+        vector<string> names;
+        while (true) {
+            const Token t = lx.nextToken();
+            const int a = T.terminalOf(t);
+            if (a >= 0) {
+                ids.push_back(a);
+                names.emplace_back(T.termName(a));
+            }
+            if (t.kind == TokenKind::Eof) break;
+        }
+
+        vector<vector<string>> traceStrings, traceDense, traceIds;
+        const size_t steps = recognizeStrings(S, names, &traceStrings);
+        if (recognizeIds(T, predictDense, ids, &traceDense) != steps || traceStrings != traceDense ||
+            recognizeIds(T, predictComb, ids, &traceIds) != steps || traceStrings != traceIds) {
+            cerr << "[FAIL] " << argv[f] << ": expansion traces differ\n";
+            return 2;
+        }
+
+        size_t sink = 0;
+        const int rounds = 50;
+        const int reps = max(1, static_cast<int>(200000 / steps));
+        const double strMs = bestMs(rounds, [&] { for (int r = 0; r < reps; ++r) sink += recognizeStrings(S, names, nullptr); }) / reps;
+        const double denseMs = bestMs(rounds, [&] { for (int r = 0; r < reps; ++r) sink += recognizeIds(T, predictDense, ids, nullptr); }) / reps;
+        const double combMs = bestMs(rounds, [&] { for (int r = 0; r < reps; ++r) sink += recognizeIds(T, predictComb, ids, nullptr); }) / reps;
+        cout << argv[f] << ": " << ids.size() << " tokens, " << steps << " steps, "
+             << traceIds.size() << " expansions\n";
+        cout << "  string table: " << strMs * 1e6 / steps << " ns/step, "
+             << ids.size() / (strMs / 1e3) << " tokens/s\n";
+        cout << "  dense int16:  " << denseMs * 1e6 / steps << " ns/step, "
+             << ids.size() / (denseMs / 1e3) << " tokens/s (" << strMs / denseMs << "x)\n";
+        cout << "  comb vector:  " << combMs * 1e6 / steps << " ns/step, "
+             << ids.size() / (combMs / 1e3) << " tokens/s (" << strMs / combMs << "x)\n";
+        if (sink == 0) cout << "(no steps)\n";
+    }
+    return 0;
+}
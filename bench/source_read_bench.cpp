@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: source_read_bench.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Source loading benchmark: the istreambuf_iterator copy the driver used
+// to read inputs with versus io::SourceBuffer::open, which maps regular
+// files. The mapped pages are faulted in lazily, so the map is also timed
+// with one read per page, which is the least the lexer will touch.
+//
+//   g++ -std=c++17 -O2 -I./include bench/source_read_bench.cpp source_buffer.cpp -o source_read_bench
+//   ./source_read_bench test-files/*.src
+
+#include "../source_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+constexpr size_t kPage = 4096;
+
+// Best-of-`rounds` wall time of `load` over every file, in milliseconds.
+template <typename Load>
+double timeLoads(const vector<string>& paths, int rounds, Load load) {
+    double best = 1e300;
+    for (int r = 0; r < rounds; ++r) {
+        const auto t0 = chrono::steady_clock::now();
+        for (const auto& path : paths) {
+            load(path);
+        }
+        const auto t1 = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./source_read_bench <source.src>...\n";
+        return 1;
+    }
+    vector<string> paths(argv + 1, argv + argc);
+    size_t bytes = 0;
+    try {
+        for (const auto& path : paths) {
+            bytes += io::SourceBuffer::open(path).size();
+        }
+    } catch (const exception& ex) {
+        cerr << ex.what() << "\n";
+        return 1;
+    }
+
+    const int rounds = static_cast<int>(max<size_t>(5, 200000000 / max<size_t>(bytes, 1)));
+    volatile size_t sink = 0;
+    const double copyMs = timeLoads(paths, rounds, [&](const string& path) {
+        ifstream in(path);
+        const string content((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        sink = sink + content.size();
+    });
+    const double mapMs = timeLoads(paths, rounds, [&](const string& path) {
+        sink = sink + io::SourceBuffer::open(path).size();
+    });
+    const double touchMs = timeLoads(paths, rounds, [&](const string& path) {
+        const io::SourceBuffer source = io::SourceBuffer::open(path);
+        const string_view text = source.view();
+        size_t sum = 0;
+        for (size_t k = 0; k < text.size(); k += kPage) sum += static_cast<unsigned char>(text[k]);
+        sink = sink + sum;
+    });
+    const double mb = static_cast<double>(bytes) / (1024.0 * 1024.0);
+
+    cout << "corpus:               " << paths.size() << " file(s), " << bytes << " bytes (best of " << rounds
+         << ")\n";
+    cout << "istreambuf copy:      " << copyMs << " ms\n";
+    cout << "SourceBuffer::open:   " << mapMs << " ms, saves " << (copyMs - mapMs) / mb << " ms/MB\n";
+    cout << "  + one read a page:  " << touchMs << " ms, saves " << (copyMs - touchMs) / mb << " ms/MB\n";
+    return 0;
+}
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: derivation_log.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#include "derivation_log.hpp"
+
+#include <cctype>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+constexpr const char* kLogMagic = "G2DERIV";
+constexpr int kLogVersion = 1;
+
+// The readable log's notion of a nonterminal: upper-case first letter or
+// <angle-bracketed>.
+bool looksLikeNonterminal(const string& sym) {
+    if (sym.empty()) {
+        return false;
+    }
+    if (sym.front() == '<' && sym.back() == '>') {
+        return true;
+    }
+    return static_cast<bool>(isupper(static_cast<unsigned char>(sym.front())));
+}
+
+// The sentential form as the settled prefix (no nonterminal in it), kept
+// as text, and the rest as interned symbols with the leftmost on top.
+// Expanding only touches the top, so a step costs its right-hand side plus
+// the terminals it settles; printing the form is what stays linear.
+class SententialForm {
+public:
+    explicit SententialForm(const string& start) { rest.push_back(intern(start)); }
+
+    int intern(const string& name) {
+        const auto [it, added] = ids.emplace(name, static_cast<int>(names.size()));
+        if (added) {
+            names.push_back(name);
+            nonterminal.push_back(looksLikeNonterminal(name));
+        }
+        return it->second;
+    }
+
+    // Replaces the leftmost nonterminal (if any) with `rhs`, or drops it
+    // when rhs is the single symbol EPSILON.
+    void applyLeftmost(const vector<int>& rhs) {
+        settle();
+        if (rest.empty()) {
+            return;
+        }
+        rest.pop_back();
+        if (rhs.size() == 1 && names[static_cast<size_t>(rhs[0])] == "EPSILON") {
+            return;
+        }
+        rest.insert(rest.end(), rhs.rbegin(), rhs.rend());
+    }
+
+    // Replaces two or more settled symbols with "...".
+    void fold() {
+        settle();
+        if (settledCount > 1) {
+            settledText = "...";
+            settledCount = 1;
+        }
+    }
+
+    void print(ostream& out) const {
+        out << settledText;
+        bool first = settledCount == 0;
+        for (auto it = rest.rbegin(); it != rest.rend(); ++it) {
+            if (!first) out << ' ';
+            out << names[static_cast<size_t>(*it)];
+            first = false;
+        }
+        out << '\n';
+    }
+
+private:
+    void settle() {
+        while (!rest.empty() && !nonterminal[static_cast<size_t>(rest.back())]) {
+            if (settledCount++) settledText += ' ';
+            settledText += names[static_cast<size_t>(rest.back())];
+            rest.pop_back();
+        }
+    }
+
+    unordered_map<string, int> ids;
+    vector<string> names;
+    vector<bool> nonterminal;
+    string settledText;
+    size_t settledCount = 0;
+    vector<int> rest;
+};
+
+}  // namespace
+
+DerivationLog::DerivationLog(ostream& out, const Table& T, int start)
+    : out(out), T(T), spelled(static_cast<size_t>(T.productionCount()), false) {
+    out << kLogMagic << ' ' << kLogVersion << ' ' << T.symbols[static_cast<size_t>(start)] << '\n';
+}
+
+void DerivationLog::expand(int prod) {
+    out << prod;
+    if (!spelled[static_cast<size_t>(prod)]) {
+        spelled[static_cast<size_t>(prod)] = true;
+        out << " =";
+        for (const string_view sym : T.rhs(prod)) out << ' ' << sym;
+    }
+    out << '\n';
+}
+
+void DerivationLog::noRule() { out << "!\n"; }
+
+void DerivationLog::fold() { out << "...\n"; }
+
+void expandDerivation(istream& log, ostream& out) {
+    string line;
+    size_t lineNo = 1;
+    auto malformed = [&](const string& why) {
+        return runtime_error("derivation log line " + to_string(lineNo) + ": " + why);
+    };
+
+    string magic, start;
+    int version = 0;
+    if (!getline(log, line) || !(istringstream(line) >> magic >> version >> start) || magic != kLogMagic) {
+        throw malformed("not a derivation log");
+    }
+    if (version != kLogVersion) {
+        throw malformed("unsupported version " + to_string(version));
+    }
+
+    SententialForm form(start);
+    form.print(out);
+    vector<vector<int>> productions;
+    const vector<int> epsilon{form.intern("EPSILON")};
+    while (getline(log, line)) {
+        ++lineNo;
+        if (line == "!") {
+            form.applyLeftmost(epsilon);
+        } else if (line == "...") {
+            form.fold();   // not a step: shows on the next line
+            continue;
+        } else {
+            istringstream fields(line);
+            long prod = -1;
+            if (!(fields >> prod) || prod < 0) {
+                throw malformed("expected a production ID");
+            }
+            const size_t p = static_cast<size_t>(prod);
+            string sym;
+            if (fields >> sym) {
+                if (sym != "=") {
+                    throw malformed("expected '=' after the production ID");
+                }
+                if (p >= productions.size()) productions.resize(p + 1);
+                productions[p].clear();
+                while (fields >> sym) productions[p].push_back(form.intern(sym));
+            }
+            if (p >= productions.size() || productions[p].empty()) {
+                throw malformed("production " + to_string(prod) + " used before it is spelled out");
+            }
+            form.applyLeftmost(productions[p]);
+        }
+        form.print(out);
+    }
+}
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: derivation_log.hpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+
+#include "parse_table.hpp"
+
+// ---------- Compact derivation log (.outderivlog) ----------
+// The leftmost derivation as one line per parser step, instead of the whole
+// sentential form per step:
+//
+//   G2DERIV 1 START          header: format version and start symbol
+//   12 = CLASSDECL REPTSTART0   production 12, spelled out on first use
+//   12                       production 12 again
+//   !                        no rule: the leftmost nonterminal is dropped
+//   ...                      --stream: fold the settled terminals into "..."
+//                            (not a step; no line of its own when expanded)
+//
+// Production IDs are the table's, but each right-hand side is written the
+// first time it is used, so a log expands without the table.
+class DerivationLog {
+public:
+    DerivationLog(std::ostream& out, const Table& T, int start);
+
+    // The leftmost nonterminal is rewritten with production `prod`.
+    void expand(int prod);
+    void noRule();
+    void fold();
+
+private:
+    std::ostream& out;
+    const Table& T;
+    std::vector<bool> spelled;   // per production
+};
+
+// Writes the sentential form after every step of `log`, one line each, as
+// the readable .outderivation. Throws std::runtime_error on a malformed log.
+void expandDerivation(std::istream& log, std::ostream& out);
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: lexer_parallel.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Parallel lexing of one buffer with speculative chunks.
+//
+// The buffer is cut into chunks that start right after a '\n'. Every chunk
+// is lexed concurrently as if it began outside any comment, keeping the
+// tokens that start inside it. The guess is wrong only when the boundary
+// falls inside a block comment (or a token the previous chunk's lexer runs
+// past), so the chunks are then stitched in order: from where the true
+// token stream has reached, nextToken() is run serially until it yields a
+// token the speculative lexer also produced. The lexer's only state is its
+// offset, so from that token on both streams are identical and the rest of
+// the chunk is taken as is.
+
+#include "lexer_support.h"
+#include "lexer_scan.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+struct Chunk {
+    size_t begin = 0;
+    size_t end = 0;          // tokens starting at or after end belong to the next chunk
+    vector<Token> tokens;    // speculative, ascending by offset
+};
+
+void lexChunk(string_view src, Chunk& chunk) {
+    Lexer lx;
+    lx.src = src;
+    lx.i = chunk.begin;
+    while (true) {
+        const Token t = lx.nextToken();
+        if (t.offset >= chunk.end) return;
+        chunk.tokens.push_back(t);
+        if (t.kind == TokenKind::Eof) return;
+    }
+}
+
+bool sameToken(const Token& a, const Token& b) {
+    return a.kind == b.kind && a.offset == b.offset && a.length == b.length;
+}
+
+}  // namespace
+
+vector<Token> lexParallel(string_view src, unsigned threads, size_t minChunkBytes) {
+    const size_t n = src.size();
+    const size_t chunkCount = max<size_t>(1, min<size_t>(threads, n / max<size_t>(minChunkBytes, 1)));
+
+    // Chunk k starts after the first '\n' at or past k * n / chunkCount.
+    vector<Chunk> chunks;
+    size_t begin = 0;
+    for (size_t k = 1; k <= chunkCount; ++k) {
+        size_t end = n + 1;   // the last chunk also owns the Eof token
+        if (k < chunkCount) {
+            const size_t cut = lexscan::findNewline(src.data(), max(begin, k * n / chunkCount), n);
+            if (cut >= n) break;
+            end = cut + 1;
+        }
+        chunks.push_back({begin, end, {}});
+        begin = end;
+    }
+    if (chunks.empty() || chunks.back().end != n + 1) {
+        chunks.push_back({begin, n + 1, {}});
+    }
+
+    vector<thread> workers;
+    for (size_t k = 1; k < chunks.size(); ++k) {
+        workers.emplace_back(lexChunk, src, ref(chunks[k]));
+    }
+    lexChunk(src, chunks[0]);
+    for (auto& w : workers) w.join();
+
+    // Stitch. Chunk 0 starts at offset 0, so its speculation is exact.
+    vector<Token> out = move(chunks[0].tokens);
+    Lexer lx;
+    lx.src = src;
+    lx.i = out.empty() ? 0 : out.back().offset + out.back().length;
+    for (size_t k = 1; k < chunks.size(); ++k) {
+        const Chunk& chunk = chunks[k];
+        if (!out.empty() && out.back().kind == TokenKind::Eof) break;
+        while (true) {
+            const size_t before = lx.i;
+            const Token t = lx.nextToken();
+            if (t.offset >= chunk.end) {
+                lx.i = before;   // starts in a later chunk
+                break;
+            }
+            const auto spec = lower_bound(chunk.tokens.begin(), chunk.tokens.end(), t.offset,
+                                          [](const Token& a, size_t off) { return a.offset < off; });
+            if (spec != chunk.tokens.end() && sameToken(*spec, t)) {
+                out.insert(out.end(), spec, chunk.tokens.end());
+                lx.i = out.back().offset + out.back().length;
+                break;
+            }
+            out.push_back(t);
+            if (t.kind == TokenKind::Eof) break;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: lexer_scan.h
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Block-at-a-time byte scanning used by the lexer's hot loops.
+// AVX2 handles 32 bytes per step, SSE2 16; other targets (or builds without
+// those instruction sets enabled) use the scalar loops, which define the
+// semantics every vector path must reproduce.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LEXER_SCAN_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LEXER_SCAN_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace lexscan {
+
+inline bool isSpace(char c) { return c==' '||c=='\t'||c=='\r'||c=='\n'; }
+inline bool isIdentChar(char c) {
+    return (c>='A'&&c<='Z')||(c>='a'&&c<='z')||(c>='0'&&c<='9')||c=='_';
+}
+inline bool isCommentDelimiter(char c) { return c=='*' || c=='/'; }
+
+inline unsigned firstSetBit(std::uint32_t m) {
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, m);
+    return static_cast<unsigned>(idx);
+#else
+    return static_cast<unsigned>(__builtin_ctz(m));
+#endif
+}
+
+#if defined(LEXER_SCAN_AVX2) || defined(LEXER_SCAN_SSE2)
+#define LEXER_SCAN_SIMD 1
+
+// Thin wrappers so the scanners below are written once for both widths.
+#if defined(LEXER_SCAN_AVX2)
+using Block = __m256i;
+constexpr std::size_t kBlockBytes = 32;
+inline Block load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+inline Block splat(char c) { return _mm256_set1_epi8(c); }
+inline Block eq(Block a, Block b) { return _mm256_cmpeq_epi8(a, b); }
+inline Block gt(Block a, Block b) { return _mm256_cmpgt_epi8(a, b); }
+inline Block both(Block a, Block b) { return _mm256_and_si256(a, b); }
+inline Block either(Block a, Block b) { return _mm256_or_si256(a, b); }
+inline std::uint32_t bits(Block a) { return static_cast<std::uint32_t>(_mm256_movemask_epi8(a)); }
+#else
+using Block = __m128i;
+constexpr std::size_t kBlockBytes = 16;
+inline Block load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline Block splat(char c) { return _mm_set1_epi8(c); }
+inline Block eq(Block a, Block b) { return _mm_cmpeq_epi8(a, b); }
+inline Block gt(Block a, Block b) { return _mm_cmpgt_epi8(a, b); }
+inline Block both(Block a, Block b) { return _mm_and_si128(a, b); }
+inline Block either(Block a, Block b) { return _mm_or_si128(a, b); }
+inline std::uint32_t bits(Block a) { return static_cast<std::uint32_t>(_mm_movemask_epi8(a)); }
+#endif
+
+// Signed byte compare: bytes >= 0x80 are negative and never fall inside
+// an ASCII range, which is what the scalar predicates say as well.
+inline Block inRange(Block v, char lo, char hi) {
+    return both(gt(v, splat(static_cast<char>(lo - 1))), gt(splat(static_cast<char>(hi + 1)), v));
+}
+
+inline std::uint32_t newlineBits(Block v) { return bits(eq(v, splat('\n'))); }
+inline std::uint32_t nonSpaceBits(Block v) {
+    const Block space = either(either(eq(v, splat(' ')), eq(v, splat('\t'))),
+                               either(eq(v, splat('\r')), eq(v, splat('\n'))));
+    return ~bits(space) & ((kBlockBytes == 32) ? 0xFFFFFFFFu : 0xFFFFu);
+}
+inline std::uint32_t nonIdentBits(Block v) {
+    const Block ident = either(either(inRange(v, 'a', 'z'), inRange(v, 'A', 'Z')),
+                               either(inRange(v, '0', '9'), eq(v, splat('_'))));
+    return ~bits(ident) & ((kBlockBytes == 32) ? 0xFFFFFFFFu : 0xFFFFu);
+}
+inline std::uint32_t commentDelimiterBits(Block v) {
+    return bits(either(eq(v, splat('*')), eq(v, splat('/'))));
+}
+#endif
+
+// First p' in [p, n) whose byte makes `stop` true, or n. `stopBits` is the
+// vector form of the same predicate.
+// Most identifiers and whitespace runs in real code are a few bytes long,
+// so the first kScalarLead bytes are checked one at a time before paying
+// for vector loads.
+constexpr std::size_t kScalarLead = 8;
+
+template <typename StopBits, typename Stop>
+inline std::size_t scanUntil(const char* s, std::size_t p, std::size_t n,
+                             [[maybe_unused]] StopBits stopBits, Stop stop) {
+#if defined(LEXER_SCAN_SIMD)
+    for (const std::size_t lead = (n - p < kScalarLead) ? n : p + kScalarLead; p < lead; ++p) {
+        if (stop(s[p])) {
+            return p;
+        }
+    }
+    while (p + kBlockBytes <= n) {
+        const std::uint32_t m = stopBits(load(s + p));
+        if (m != 0) {
+            return p + firstSetBit(m);
+        }
+        p += kBlockBytes;
+    }
+#endif
+    while (p < n && !stop(s[p])) {
+        ++p;
+    }
+    return p;
+}
+
+#if defined(LEXER_SCAN_SIMD)
+#define LEXER_SCAN_BITS(fn) fn
+#else
+#define LEXER_SCAN_BITS(fn) nullptr
+#endif
+
+inline std::size_t skipSpaces(const char* s, std::size_t p, std::size_t n) {
+    return scanUntil(s, p, n, LEXER_SCAN_BITS(nonSpaceBits), [](char c) { return !isSpace(c); });
+}
+inline std::size_t skipIdentChars(const char* s, std::size_t p, std::size_t n) {
+    return scanUntil(s, p, n, LEXER_SCAN_BITS(nonIdentBits), [](char c) { return !isIdentChar(c); });
+}
+inline std::size_t findNewline(const char* s, std::size_t p, std::size_t n) {
+    return scanUntil(s, p, n, LEXER_SCAN_BITS(newlineBits), [](char c) { return c == '\n'; });
+}
+inline std::size_t findCommentDelimiter(const char* s, std::size_t p, std::size_t n) {
+    return scanUntil(s, p, n, LEXER_SCAN_BITS(commentDelimiterBits), isCommentDelimiter);
+}
+
+#undef LEXER_SCAN_BITS
+
+// Calls onNewline(offset) for every '\n' in [p, n), in order.
+template <typename OnNewline>
+inline void forEachNewline(const char* s, std::size_t p, std::size_t n, OnNewline onNewline) {
+#if defined(LEXER_SCAN_SIMD)
+    while (p + kBlockBytes <= n) {
+        for (std::uint32_t m = newlineBits(load(s + p)); m != 0; m &= m - 1) {
+            onNewline(p + firstSetBit(m));
+        }
+        p += kBlockBytes;
+    }
+#endif
+    for (; p < n; ++p) {
+        if (s[p] == '\n') {
+            onNewline(p);
+        }
+    }
+}
+
+}  // namespace lexscan
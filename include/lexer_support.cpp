@@ -10,24 +10,149 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "lexer_support.h"
+#include "lexer_scan.h"
+#include <algorithm>
+#include <charconv>
 #include <sstream>
 #include <cctype>
+#include <system_error>
 
 using namespace std;
 
+// Kept for callers that want the keyword list as strings; the lexer itself
+// uses keywordKind() below.
 const unordered_set<string> KEYWORDS = {
     "integer","float","void","class","return","while","if","then","else",
     "function","constructor","attribute","public","private","self","localvar",
     "read","write","and","or","not","isa"
 };
 
+static constexpr const char* TOKEN_KIND_NAMES[] = {
+    "integer","float","void","class","return","while","if","then","else",
+    "function","constructor","attribute","public","private","self","localvar",
+    "read","write","and","or","not","isa",
+    "id","intnum","floatnum",
+    "eq","noteq","leq","geq","returntype","scopeop",
+    "plus","minus","mult","div",
+    "openpar","closepar","opensqbr","closesqbr","opencubr","closecubr",
+    "semi","comma","colon","dot","lt","gt","assign",
+    "inlinecmt","blockcmt",
+    "invalidcomment","invalidid","invalidnum","invalidchar",
+    "eof"
+};
+static_assert(sizeof(TOKEN_KIND_NAMES) / sizeof(TOKEN_KIND_NAMES[0]) == static_cast<size_t>(TokenKind::Count),
+              "TOKEN_KIND_NAMES must list every TokenKind");
+
+const char* tokenKindName(TokenKind kind) {
+    return TOKEN_KIND_NAMES[static_cast<size_t>(kind)];
+}
+
+// ---- keyword recognition via a compile-time perfect hash
+// slot = (c0*a + c1*b + cLast*c + len) mod 64, where (a, b, c) is the first
+// triple found at compile time that sends the 22 keywords to distinct slots.
+// A lookup is one hash, one table load and at most one length+memcmp check.
+namespace {
+
+constexpr size_t kKeywordSlots = 64;
+constexpr size_t kMinKeywordLength = 2;   // "if", "or"
+constexpr size_t kMaxKeywordLength = 11;  // "constructor"
+constexpr uint8_t kNoKeyword = 0xFF;
+
+struct KeywordHash { unsigned a, b, c; };
+
+constexpr size_t keywordSlot(const KeywordHash& h, const char* w, size_t n) {
+    return (static_cast<unsigned char>(w[0]) * h.a +
+            static_cast<unsigned char>(w[1]) * h.b +
+            static_cast<unsigned char>(w[n - 1]) * h.c + n) & (kKeywordSlots - 1);
+}
+
+constexpr KeywordHash findKeywordHash() {
+    for (unsigned a = 1; a < 32; ++a) {
+        for (unsigned b = 1; b < 32; ++b) {
+            for (unsigned c = 1; c < 32; ++c) {
+                bool used[kKeywordSlots] = {};
+                bool ok = true;
+                for (int k = 0; k < kKeywordCount && ok; ++k) {
+                    const string_view w = TOKEN_KIND_NAMES[k];
+                    const size_t slot = keywordSlot({a, b, c}, w.data(), w.size());
+                    ok = !used[slot];
+                    used[slot] = true;
+                }
+                if (ok) return {a, b, c};
+            }
+        }
+    }
+    return {0, 0, 0};
+}
+
+constexpr KeywordHash KEYWORD_HASH = findKeywordHash();
+static_assert(KEYWORD_HASH.a != 0, "no collision-free keyword hash in the search range");
+
+struct KeywordSlots {
+    uint8_t kind[kKeywordSlots];
+    string_view text[kKeywordSlots];   // empty for unused slots
+};
+
+constexpr KeywordSlots buildKeywordSlots() {
+    KeywordSlots table{};
+    for (size_t s = 0; s < kKeywordSlots; ++s) table.kind[s] = kNoKeyword;
+    for (int k = 0; k < kKeywordCount; ++k) {
+        const string_view w = TOKEN_KIND_NAMES[k];
+        const size_t slot = keywordSlot(KEYWORD_HASH, w.data(), w.size());
+        table.kind[slot] = static_cast<uint8_t>(k);
+        table.text[slot] = w;
+    }
+    return table;
+}
+
+constexpr KeywordSlots KEYWORD_SLOTS = buildKeywordSlots();
+
+}  // namespace
+
+TokenKind keywordKind(string_view word) {
+    const size_t n = word.size();
+    if (n < kMinKeywordLength || n > kMaxKeywordLength) return TokenKind::Id;
+    const size_t slot = keywordSlot(KEYWORD_HASH, word.data(), n);
+    if (KEYWORD_SLOTS.text[slot] == word) return static_cast<TokenKind>(KEYWORD_SLOTS.kind[slot]);
+    return TokenKind::Id;
+}
+
+void LineIndex::extend(string_view src) {
+    if (indexed >= src.size()) return;
+    lexscan::forEachNewline(src.data(), indexed, src.size(),
+                            [this](size_t p) { newlines.push_back(static_cast<uint32_t>(p)); });
+    indexed = src.size();
+}
+
+void LineIndex::slide(size_t shift) {
+    const auto kept = lower_bound(newlines.begin(), newlines.end(), static_cast<uint32_t>(shift));
+    if (kept == newlines.begin()) {
+        colBefore += static_cast<int>(shift);
+    } else {
+        colBefore = static_cast<int>(shift - *(kept - 1) - 1);
+    }
+    linesBefore += static_cast<int>(kept - newlines.begin());
+    newlines.erase(newlines.begin(), kept);
+    for (auto& nl : newlines) nl -= static_cast<uint32_t>(shift);
+    indexed -= shift;
+}
+
+SourcePos LineIndex::at(size_t offset) const {
+    // Newlines strictly before `offset` give the line; the last of them
+    // gives the column.
+    const auto it = lower_bound(newlines.begin(), newlines.end(), static_cast<uint32_t>(offset));
+    const int before = static_cast<int>(it - newlines.begin());
+    if (before == 0) {
+        return {linesBefore + 1, colBefore + static_cast<int>(offset) + 1};
+    }
+    return {linesBefore + before + 1, static_cast<int>(offset - *(it - 1))};
+}
+
 bool Lexer::atEnd() const { return i >= src.size(); }
 char Lexer::peek(int k) const { return (i + k < src.size()) ? src[i + k] : '\0'; }
 
 char Lexer::advance() {
     char c = peek();
-    if (c == '\n') { line++; col = 1; }
-    else col++;
     i++;
     return c;
 }
@@ -37,156 +162,160 @@ bool Lexer::isDigit (char c){ return (c>='0'&&c<='9'); }
 bool Lexer::isAlphanumUnderscore(char c){ return isLetter(c)||isDigit(c)||c=='_'; }
 bool Lexer::isSpace(char c){ return c==' '||c=='\t'||c=='\r'||c=='\n'; }
 
-void Lexer::skipWhitespace() { while (isSpace(peek())) advance(); }
+void Lexer::skipWhitespace() {
+    if (!isSpace(peek())) return;
+    advanceTo(lexscan::skipSpaces(src.data(), i, src.size()));
+}
 bool Lexer::match(char a, char b){ return peek()==a && peek(1)==b; }
 
-// ---- same tokenization routines as in your A1:
-Token Lexer::readInlineComment(int L, int C) {
-    string lex = "//";
-    advance(); advance();
-    while (!atEnd() && peek()!='\n') lex.push_back(advance());
-    return Token{"inlinecmt", lex, L, C};
-}
-Token Lexer::readBlockComment(int L, int C) {
-    string lex; lex.push_back(advance()); // '/'
-    lex.push_back(advance());             // '*'
-    int depth = 1;
-    while (!atEnd()) {
-        if (peek()=='/' && peek(1)=='*') { lex.push_back(advance()); lex.push_back(advance()); depth++; }
-        else if (peek()=='*' && peek(1)=='/') { lex.push_back(advance()); lex.push_back(advance()); depth--; if (depth==0) return Token{"blockcmt", lex, L, C}; }
-        else { lex.push_back(advance()); }
+// Token spanning src[start, i).
+Token Lexer::make(TokenKind kind, size_t start) const {
+    Token t;
+    t.kind = kind;
+    t.offset = static_cast<uint32_t>(start);
+    t.length = static_cast<uint32_t>(i - start);
+    return t;
+}
+
+// Validated IntNum / FloatNum spanning src[start, i), with its value.
+Token Lexer::makeNumber(TokenKind kind, size_t start) const {
+    Token t = make(kind, start);
+    const char* first = src.data() + start;
+    const char* last = src.data() + i;
+    if (kind == TokenKind::IntNum) {
+        t.hasValue = from_chars(first, last, t.intValue).ec == errc();
+    } else {
+        t.hasValue = from_chars(first, last, t.floatValue).ec == errc();
     }
-    return Token{"invalidcomment", lex, L, C};
-}
-
-Token Lexer::readIdentifier(int L, int C) {
-    string lex; lex.push_back(advance());
-    while (isAlphanumUnderscore(peek())) lex.push_back(advance());
-    if (KEYWORDS.count(lex)) return Token{lex, lex, L, C};
-    return Token{"id", lex, L, C};
-}
-Token Lexer::readInvalidIdentifierStartingWithUnderscore(int L, int C) {
-    string bad; bad.push_back(advance());
-    while (isLetter(peek()) || isDigit(peek()) || peek()=='_') bad.push_back(advance());
-    return Token{"invalidid", bad, L, C};
-}
-
-Token Lexer::readNumberGreedyAndValidate(int L, int C) {
-    string lex;
-    if (!isDigit(peek())) { char ch = advance(); return Token{"invalidnum", string(1,ch), L, C}; }
-    while (isDigit(peek())) lex.push_back(advance());
-
-    bool sawDot = false;
-    if (peek()=='.') {
-        sawDot = true;
-        lex.push_back(advance());
-        while (isDigit(peek())) lex.push_back(advance());
-        if (peek()=='e' || peek()=='E') {
-            lex.push_back(advance());
-            if (peek()=='+' || peek()=='-') lex.push_back(advance());
-            if (isDigit(peek())) while (isDigit(peek())) lex.push_back(advance());
+    return t;
+}
+
+size_t Lexer::scanLineComment(size_t p) const {
+    return lexscan::findNewline(src.data(), p, src.size());
+}
+size_t Lexer::scanBlockComment(size_t p, int& depth) const {
+    const char* s = src.data();
+    const size_t n = src.size();
+    // Only '*' and '/' can open or close a comment level, so jump straight
+    // to the next one; everything between is comment text.
+    while ((p = lexscan::findCommentDelimiter(s, p, n)) + 1 < n) {
+        if (s[p]=='/' && s[p + 1]=='*') { p += 2; depth++; }
+        else if (s[p]=='*' && s[p + 1]=='/') {
+            p += 2;
+            if (--depth == 0) return p;
         }
+        else { p++; }
     }
-    while (isLetter(peek()) || peek()=='_') lex.push_back(advance());
-
-    auto allDigits = [](const string& s)->bool{
-        if (s.empty()) return false;
-        for (char c: s) if (!isdigit(static_cast<unsigned char>(c))) return false;
-        return true;
-    };
-    auto validInteger = [&](const string& s)->bool{
-        if (!allDigits(s)) return false;
-        if (s=="0") return true;
-        return s[0] != '0';
-    };
-
-    bool hasE = (lex.find('e') != string::npos) || (lex.find('E') != string::npos);
-    bool hasAlphaOrU = false;
-    for (char ch: lex) if (isalpha(static_cast<unsigned char>(ch)) || ch=='_') { hasAlphaOrU = true; break; }
-
-    if (!sawDot && !hasE && !hasAlphaOrU) {
-        if (validInteger(lex)) return Token{"intnum", lex, L, C};
-        return Token{"invalidnum", lex, L, C};
-    }
+    return p;
+}
 
-    size_t pos = 0;
-    while (pos < lex.size() && isdigit(static_cast<unsigned char>(lex[pos]))) pos++;
-    string intPart = lex.substr(0, pos);
-    if (pos >= lex.size() || lex[pos] != '.') return Token{"invalidnum", lex, L, C};
-    pos++;
-
-    string fracDigits;
-    while (pos < lex.size() && isdigit(static_cast<unsigned char>(lex[pos]))) { fracDigits.push_back(lex[pos]); pos++; }
-
-    bool hasExp = false;
-    string expDigits;
-    if (pos < lex.size() && (lex[pos]=='e' || lex[pos]=='E')) {
-        hasExp = true; pos++;
-        if (pos < lex.size() && (lex[pos]=='+'||lex[pos]=='-')) pos++;
-        while (pos < lex.size() && isdigit(static_cast<unsigned char>(lex[pos]))) { expDigits.push_back(lex[pos]); pos++; }
-    }
+// ---- same tokenization routines as in your A1:
+Token Lexer::readInlineComment() {
+    const size_t start = i;
+    advanceTo(scanLineComment(i + 2));
+    return make(TokenKind::InlineCmt, start);
+}
+Token Lexer::readBlockComment() {
+    const size_t start = i;
+    int depth = 1;
+    const size_t p = scanBlockComment(i + 2, depth); // past '/' '*'
+    if (depth == 0) { advanceTo(p); return make(TokenKind::BlockCmt, start); }
+    advanceTo(src.size());
+    return make(TokenKind::InvalidComment, start);
+}
 
-    if (pos != lex.size()) return Token{"invalidnum", lex, L, C};
-    auto allDigits2 = [&](const string& s){ if(s.empty()) return false; for(char c:s) if(!isdigit((unsigned char)c)) return false; return true; };
-    if (!(intPart=="0" || (allDigits2(intPart) && intPart[0]!='0'))) return Token{"invalidnum", lex, L, C};
+Token Lexer::readIdentifier() {
+    const size_t start = i;
+    advanceTo(lexscan::skipIdentChars(src.data(), i + 1, src.size()));
+    return make(keywordKind(src.substr(start, i - start)), start);
+}
+Token Lexer::readInvalidIdentifierStartingWithUnderscore() {
+    const size_t start = i;
+    advanceTo(lexscan::skipIdentChars(src.data(), i + 1, src.size()));
+    return make(TokenKind::InvalidId, start);
+}
 
-    if (fracDigits == "0") {
-        // ok
-    } else {
-        if (fracDigits.empty()) return Token{"invalidnum", lex, L, C};
-        if (fracDigits.back()=='0') return Token{"invalidnum", lex, L, C};
-    }
+// One forward pass over the same greedy span as always,
+//   digits [ '.' digits [ ('e'|'E') ['+'|'-'] digits ] ] [letters/'_']*
+// checking the intnum/floatnum rules on the way: no leading zero in the
+// integer part or exponent, fraction "0" or without a trailing zero, a
+// non-empty exponent, and no letter suffix.
+Token Lexer::readNumberGreedyAndValidate() {
+    const size_t start = i;
+    if (!isDigit(peek())) { advance(); return make(TokenKind::InvalidNum, start); }
+    const char* s = src.data();
+    const size_t n = src.size();
+    auto skipDigits = [&](size_t p) { while (p < n && isDigit(s[p])) p++; return p; };
 
-    if (hasExp) {
-        if (!allDigits2(expDigits)) return Token{"invalidnum", lex, L, C};
-        if (!(expDigits=="0" || (expDigits[0]!='0'))) return Token{"invalidnum", lex, L, C};
+    size_t p = skipDigits(i);
+    bool valid = (p - start == 1 || s[start] != '0');
+    bool isFloat = false;
+    if (p < n && s[p] == '.') {
+        isFloat = true;
+        const size_t fracStart = p + 1;
+        p = skipDigits(fracStart);
+        valid = valid && p > fracStart && (p - fracStart == 1 || s[p - 1] != '0');
+        if (p < n && (s[p] == 'e' || s[p] == 'E')) {
+            p++;
+            if (p < n && (s[p] == '+' || s[p] == '-')) p++;
+            const size_t expStart = p;
+            p = skipDigits(expStart);
+            valid = valid && p > expStart && (p - expStart == 1 || s[expStart] != '0');
+        }
+    }
+    if (p < n && (isLetter(s[p]) || s[p] == '_')) {
+        valid = false;
+        while (p < n && (isLetter(s[p]) || s[p] == '_')) p++;
     }
+    advanceTo(p);
 
-    return Token{"floatnum", lex, L, C};
+    if (!valid) return make(TokenKind::InvalidNum, start);
+    return makeNumber(isFloat ? TokenKind::FloatNum : TokenKind::IntNum, start);
 }
 
 Token Lexer::nextToken() {
     skipWhitespace();
-    if (atEnd()) return Token{"eof","", line, col};
+    if (atEnd()) return make(TokenKind::Eof, i);
 
-    int L=line, C=col;
+    const size_t start = i;
     char c = peek();
 
-    if (c=='/' && peek(1)=='/') return readInlineComment(L, C);
-    if (c=='/' && peek(1)=='*') return readBlockComment(L, C);
+    if (c=='/' && peek(1)=='/') return readInlineComment();
+    if (c=='/' && peek(1)=='*') return readBlockComment();
 
-    if (isLetter(c)) return readIdentifier(L, C);
-    if (c=='_') return readInvalidIdentifierStartingWithUnderscore(L, C);
+    if (isLetter(c)) return readIdentifier();
+    if (c=='_') return readInvalidIdentifierStartingWithUnderscore();
 
-    if (isDigit(c)) return readNumberGreedyAndValidate(L, C);
+    if (isDigit(c)) return readNumberGreedyAndValidate();
 
-    if (match('=','=')) { advance(); advance(); return Token{"eq","==",L,C}; }
-    if (match('<','>')) { advance(); advance(); return Token{"noteq","<>",L,C}; }
-    if (match('<','=')) { advance(); advance(); return Token{"leq","<=",L,C}; }
-    if (match('>','=')) { advance(); advance(); return Token{"geq",">=",L,C}; }
-    if (match('=','>')) { advance(); advance(); return Token{"returntype","=>",L,C}; }
-    if (match(':',':')) { advance(); advance(); return Token{"scopeop","::",L,C}; }
+    if (match('=','=')) { advance(); advance(); return make(TokenKind::Eq,start); }
+    if (match('<','>')) { advance(); advance(); return make(TokenKind::NotEq,start); }
+    if (match('<','=')) { advance(); advance(); return make(TokenKind::Leq,start); }
+    if (match('>','=')) { advance(); advance(); return make(TokenKind::Geq,start); }
+    if (match('=','>')) { advance(); advance(); return make(TokenKind::ReturnType,start); }
+    if (match(':',':')) { advance(); advance(); return make(TokenKind::ScopeOp,start); }
 
+    TokenKind kind = TokenKind::InvalidChar;
     switch(c){
-        case '+': advance(); return Token{"plus", "+", L, C};
-        case '-': advance(); return Token{"minus","-", L, C};
-        case '*': advance(); return Token{"mult","*", L, C};
-        case '/': advance(); return Token{"div","/", L, C};
-        case '(': advance(); return Token{"openpar","(", L, C};
-        case ')': advance(); return Token{"closepar",")", L, C};
-        case '[': advance(); return Token{"opensqbr","[", L, C};
-        case ']': advance(); return Token{"closesqbr","]", L, C};
-        case '{': advance(); return Token{"opencubr","{", L, C};
-        case '}': advance(); return Token{"closecubr","}", L, C};
-        case ';': advance(); return Token{"semi",";", L, C};
-        case ',': advance(); return Token{"comma",",", L, C};
-        case ':': advance(); return Token{"colon",":", L, C};
-        case '.': advance(); return Token{"dot",".", L, C};
-        case '<': advance(); return Token{"lt","<", L, C};
-        case '>': advance(); return Token{"gt",">", L, C};
-        case '=': advance(); return Token{"assign","=", L, C};
+        case '+': kind = TokenKind::Plus; break;
+        case '-': kind = TokenKind::Minus; break;
+        case '*': kind = TokenKind::Mult; break;
+        case '/': kind = TokenKind::Div; break;
+        case '(': kind = TokenKind::OpenPar; break;
+        case ')': kind = TokenKind::ClosePar; break;
+        case '[': kind = TokenKind::OpenSqbr; break;
+        case ']': kind = TokenKind::CloseSqbr; break;
+        case '{': kind = TokenKind::OpenCubr; break;
+        case '}': kind = TokenKind::CloseCubr; break;
+        case ';': kind = TokenKind::Semi; break;
+        case ',': kind = TokenKind::Comma; break;
+        case ':': kind = TokenKind::Colon; break;
+        case '.': kind = TokenKind::Dot; break;
+        case '<': kind = TokenKind::Lt; break;
+        case '>': kind = TokenKind::Gt; break;
+        case '=': kind = TokenKind::Assign; break;
     }
 
-    char bad = advance();
-    return Token{"invalidchar", string(1,bad), L, C};
+    advance();
+    return make(kind, start);
 }
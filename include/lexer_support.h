@@ -10,22 +10,110 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
+// Token kinds produced by the lexer. The 22 keywords come first and in the
+// same order as KEYWORDS so a keyword kind can be computed from its index.
+enum class TokenKind : std::uint8_t {
+    Integer, Float, Void, Class, Return, While, If, Then, Else,
+    Function, Constructor, Attribute, Public, Private, Self, Localvar,
+    Read, Write, And, Or, Not, Isa,
+
+    Id, IntNum, FloatNum,
+
+    Eq, NotEq, Leq, Geq, ReturnType, ScopeOp,
+    Plus, Minus, Mult, Div,
+    OpenPar, ClosePar, OpenSqbr, CloseSqbr, OpenCubr, CloseCubr,
+    Semi, Comma, Colon, Dot, Lt, Gt, Assign,
+
+    InlineCmt, BlockCmt,
+    InvalidComment, InvalidId, InvalidNum, InvalidChar,
+
+    Eof,
+    Count
+};
+
+constexpr int kKeywordCount = static_cast<int>(TokenKind::Isa) + 1;
+
+// A1 token name for a kind ("id", "intnum", "noteq", ...). Only needed when
+// a token is written to .outtokens or quoted in a diagnostic.
+const char* tokenKindName(TokenKind kind);
+
+inline bool isKeywordKind(TokenKind kind) {
+    return static_cast<int>(kind) < kKeywordCount;
+}
+inline bool isInvalidKind(TokenKind kind) {
+    return kind >= TokenKind::InvalidComment && kind <= TokenKind::InvalidChar;
+}
+
+// Compact token record. The lexeme is not copied: it is the byte range
+// [offset, offset + length) of the source buffer the lexer scanned. Its
+// line/column is looked up in a LineIndex only when something prints it.
 struct Token {
-    std::string type;
-    std::string lexeme;
+    TokenKind kind = TokenKind::Eof;
+    std::uint32_t offset = 0;
+    std::uint32_t length = 0;
+    // IntNum / FloatNum: the literal's value, parsed once by the lexer.
+    // hasValue is false if it does not fit an int64 / double.
+    bool hasValue = false;
+    union {
+        std::int64_t intValue = 0;
+        double floatValue;
+    };
+
+    std::string_view text(std::string_view source) const {
+        return source.substr(offset, length);
+    }
+};
+
+// 1-based line and column (in bytes) of a source offset.
+struct SourcePos {
     int line = 1;
     int col  = 1;
 };
 
+// Offsets of the '\n' bytes of a source, found with the block scanners in
+// lexer_scan.h; at() is a binary search. Also usable over a sliding window
+// (--stream): slide() forgets the window's leading bytes but keeps count of
+// the lines and partial line they held.
+class LineIndex {
+public:
+    // Indexes src beyond what earlier calls already covered.
+    void extend(std::string_view src);
+    // The first `shift` bytes of the window were dropped; later offsets
+    // move down by `shift`. Bytes dropped must have been indexed.
+    void slide(std::size_t shift);
+    SourcePos at(std::size_t offset) const;
+
+private:
+    std::vector<std::uint32_t> newlines;
+    std::size_t indexed = 0;
+    int linesBefore = 0;   // newlines slid out of the window
+    int colBefore = 0;     // bytes of the current line slid out of the window
+};
+
 extern const std::unordered_set<std::string> KEYWORDS;
 
+// Keyword kind for `word`, or TokenKind::Id when it is not a keyword.
+// Allocation-free: uses a perfect hash generated at compile time.
+TokenKind keywordKind(std::string_view word);
+
+// Every token of `src` up to and including Eof, lexed in up to `threads`
+// newline-aligned chunks of at least `minChunkBytes` at once
+// (lexer_parallel.cpp). Identical to calling Lexer::nextToken() until Eof.
+std::vector<Token> lexParallel(std::string_view src, unsigned threads,
+                               std::size_t minChunkBytes = 64 * 1024);
+
+// The lexer does not own its input: `src` views a buffer (a mapped file,
+// a string, ...) that must outlive the lexer and every Token it returns.
+// It tracks only the byte offset; see LineIndex for positions.
 struct Lexer {
-    std::string src;
+    std::string_view src;
     size_t i = 0;
-    int line = 1, col = 1;
 
     bool atEnd() const;
     char peek(int k = 0) const;
@@ -36,14 +124,31 @@ struct Lexer {
     static bool isAlphanumUnderscore(char c);
     static bool isSpace(char c);
 
+    void advanceTo(size_t j) { i = j; }
     void skipWhitespace();
     bool match(char a, char b);
 
-    Token readInlineComment(int L, int C);
-    Token readBlockComment(int L, int C);
-    Token readIdentifier(int L, int C);
-    Token readInvalidIdentifierStartingWithUnderscore(int L, int C);
-    Token readNumberGreedyAndValidate(int L, int C);
+    Token make(TokenKind kind, size_t start) const;
+    Token makeNumber(TokenKind kind, size_t start) const;
+    std::string_view lexeme(const Token& t) const { return t.text(src); }
+
+    // Comment bodies from offset p, resumable across a --stream refill.
+    // scanLineComment returns the offset of the ending '\n', or src.size().
+    // scanBlockComment returns the offset just past the comment once depth
+    // (the levels still open) reaches 0; otherwise where src ran out, less
+    // a final '/' or '*' that may pair with the next byte.
+    size_t scanLineComment(size_t p) const;
+    size_t scanBlockComment(size_t p, int& depth) const;
+
+    Token readInlineComment();
+    Token readBlockComment();
+    Token readIdentifier();
+    Token readInvalidIdentifierStartingWithUnderscore();
+    Token readNumberGreedyAndValidate();
 
     Token nextToken(); // <-- the one your parser needs
+
+    // Table-driven equivalent of nextToken(); produces the identical token
+    // stream. Defined in bench/lexer_dfa.cpp and built only by lexer_bench.
+    Token nextTokenDfa();
 };
@@ -0,0 +1,396 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: ll1_generator.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#include "ll1_generator.hpp"
+
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std;
+
+// ---------- Grammar loader ----------
+namespace {
+
+string trimmed(string_view s) {
+    size_t b = 0, e = s.size();
+    while (b < e && isspace(static_cast<unsigned char>(s[b]))) ++b;
+    while (e > b && isspace(static_cast<unsigned char>(s[e - 1]))) --e;
+    return string(s.substr(b, e - b));
+}
+
+// Splits a production's text into "<name>", "'name'" and bare words.
+// Returns false on an unterminated <...> or '...'.
+bool splitSymbols(string_view text, vector<string>& out) {
+    size_t i = 0;
+    while (i < text.size()) {
+        const char c = text[i];
+        if (isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
+        size_t end;
+        if (c == '<' || c == '\'') {
+            end = text.find(c == '<' ? '>' : '\'', i + 1);
+            if (end == string_view::npos) return false;
+            ++end;
+        } else {
+            end = i;
+            while (end < text.size() && !isspace(static_cast<unsigned char>(text[end]))) ++end;
+        }
+        out.emplace_back(text.substr(i, end - i));
+        i = end;
+    }
+    return true;
+}
+
+struct GrammarBuilder {
+    Grammar& G;
+    unordered_map<string, int> termIds, nontermIds;
+
+    int term(const string& name) {
+        const auto [it, added] = termIds.emplace(name, static_cast<int>(G.terms.size()));
+        if (added) G.terms.push_back(name);
+        return it->second;
+    }
+    int nonterm(const string& name) {
+        const auto [it, added] = nontermIds.emplace(name, static_cast<int>(G.nonterms.size()));
+        if (added) G.nonterms.push_back(name);
+        return it->second;
+    }
+};
+
+}  // namespace
+
+Grammar loadGrammar(const string& path) {
+    ifstream in(path);
+    if (!in) {
+        throw runtime_error("Cannot open grammar " + path);
+    }
+    Grammar G;
+    GrammarBuilder B{G, {}, {}};
+    B.term("$");
+
+    string line;
+    int lineNo = 0;
+    auto malformed = [&](const string& why) {
+        return runtime_error(path + ":" + to_string(lineNo) + ": " + why);
+    };
+    while (getline(in, line)) {
+        ++lineNo;
+        const size_t arrow = line.find("::=");
+        if (arrow == string::npos) {
+            if (!trimmed(line).empty()) throw malformed("expected <lhs> ::= ...");
+            continue;
+        }
+        const string lhs = trimmed(string_view(line).substr(0, arrow));
+        if (lhs.size() < 3 || lhs.front() != '<' || lhs.back() != '>') {
+            throw malformed("left-hand side is not a <nonterminal>");
+        }
+        Grammar::Production prod;
+        prod.lhs = B.nonterm(trimmed(string_view(lhs).substr(1, lhs.size() - 2)));
+        prod.line = lineNo;
+
+        vector<string> symbols;
+        if (!splitSymbols(string_view(line).substr(arrow + 3), symbols)) {
+            throw malformed("unterminated symbol");
+        }
+        for (const auto& sym : symbols) {
+            if (sym == "EPSILON") continue;
+            const string name = trimmed(string_view(sym).substr(1, sym.size() - 2));
+            if (sym.front() == '<') {
+                prod.rhs.push_back({false, B.nonterm(name)});
+            } else if (sym.front() == '\'' && !name.empty()) {
+                prod.rhs.push_back({true, B.term(name)});
+            } else {
+                throw malformed("unexpected symbol " + sym);
+            }
+        }
+        if (prod.rhs.empty() && symbols.size() != 1) {
+            throw malformed("empty right-hand side (write EPSILON)");
+        }
+        G.productions.push_back(move(prod));
+    }
+    if (G.productions.empty()) {
+        throw runtime_error("Grammar " + path + " has no productions");
+    }
+
+    vector<bool> defined(G.nonterms.size(), false);
+    for (const auto& p : G.productions) defined[static_cast<size_t>(p.lhs)] = true;
+    for (size_t A = 0; A < G.nonterms.size(); ++A) {
+        if (!defined[A]) {
+            throw runtime_error("Grammar " + path + " uses <" + G.nonterms[A] + "> without defining it");
+        }
+    }
+    return G;
+}
+
+// ---------- FIRST / FOLLOW / predict ----------
+LL1Analysis analyzeLL1(const Grammar& G) {
+    const size_t N = G.nonterms.size();
+    const size_t M = G.terms.size();
+    LL1Analysis L;
+    L.nullable.assign(N, false);
+    L.first.assign(N, TermSet(M));
+    L.follow.assign(N, TermSet(M));
+
+    // FIRST and nullable together: each sweep adds whatever the current
+    // sets imply, until a sweep adds nothing.
+    for (bool changed = true; changed;) {
+        changed = false;
+        ++L.passes;
+        for (const auto& p : G.productions) {
+            const size_t A = static_cast<size_t>(p.lhs);
+            bool allNullable = true;
+            for (const auto& X : p.rhs) {
+                if (X.terminal) {
+                    if (!L.first[A].test(X.index)) {
+                        L.first[A].set(X.index);
+                        changed = true;
+                    }
+                    allNullable = false;
+                    break;
+                }
+                changed |= L.first[A].unite(L.first[static_cast<size_t>(X.index)]);
+                if (!L.nullable[static_cast<size_t>(X.index)]) {
+                    allNullable = false;
+                    break;
+                }
+            }
+            if (allNullable && !L.nullable[A]) {
+                L.nullable[A] = true;
+                changed = true;
+            }
+        }
+    }
+
+    // FOLLOW, walking each right-hand side backwards with the set of what
+    // may follow the current position.
+    L.follow[0].set(0);
+    for (bool changed = true; changed;) {
+        changed = false;
+        ++L.passes;
+        for (const auto& p : G.productions) {
+            TermSet trailer = L.follow[static_cast<size_t>(p.lhs)];
+            for (auto X = p.rhs.rbegin(); X != p.rhs.rend(); ++X) {
+                if (X->terminal) {
+                    trailer = TermSet(M);
+                    trailer.set(X->index);
+                    continue;
+                }
+                const size_t B = static_cast<size_t>(X->index);
+                changed |= L.follow[B].unite(trailer);
+                if (!L.nullable[B]) trailer = TermSet(M);
+                trailer.unite(L.first[B]);
+            }
+        }
+    }
+
+    L.cells.assign(N * M, -1);
+    map<pair<int, int>, LL1Conflict> conflicts;
+    for (size_t k = 0; k < G.productions.size(); ++k) {
+        const auto& p = G.productions[k];
+        TermSet predict(M);
+        bool allNullable = true;
+        for (const auto& X : p.rhs) {
+            if (X.terminal) {
+                predict.set(X.index);
+                allNullable = false;
+                break;
+            }
+            predict.unite(L.first[static_cast<size_t>(X.index)]);
+            if (!L.nullable[static_cast<size_t>(X.index)]) {
+                allNullable = false;
+                break;
+            }
+        }
+        if (allNullable) predict.unite(L.follow[static_cast<size_t>(p.lhs)]);
+
+        for (size_t t = 0; t < M; ++t) {
+            if (!predict.test(static_cast<int>(t))) continue;
+            int& cell = L.cells[static_cast<size_t>(p.lhs) * M + t];
+            if (cell < 0) {
+                cell = static_cast<int>(k);
+                continue;
+            }
+            LL1Conflict& c = conflicts[{p.lhs, static_cast<int>(t)}];
+            if (c.productions.empty()) c = {p.lhs, static_cast<int>(t), {cell}};
+            c.productions.push_back(static_cast<int>(k));
+        }
+        L.predict.push_back(move(predict));
+    }
+    for (auto& [key, c] : conflicts) L.conflicts.push_back(move(c));
+    return L;
+}
+
+string productionText(const Grammar& G, int prod) {
+    const auto& p = G.productions[static_cast<size_t>(prod)];
+    string out = "<" + G.nonterms[static_cast<size_t>(p.lhs)] + "> ::=";
+    if (p.rhs.empty()) out += " EPSILON";
+    for (const auto& X : p.rhs) {
+        out += X.terminal ? " '" + G.terms[static_cast<size_t>(X.index)] + "'"
+                          : " <" + G.nonterms[static_cast<size_t>(X.index)] + ">";
+    }
+    return out;
+}
+
+string describeConflict(const Grammar& G, const LL1Conflict& c) {
+    string out = "<" + G.nonterms[static_cast<size_t>(c.nonterm)] + "> on '" +
+                 G.terms[static_cast<size_t>(c.term)] + "':";
+    for (int p : c.productions) {
+        out += "\n    line " + to_string(G.productions[static_cast<size_t>(p)].line) + ": " +
+               productionText(G, p);
+    }
+    return out;
+}
+
+// ---------- .first / .follow comparison ----------
+namespace {
+
+// FIRST(<A>)= ['a', 'b', EPSILON] -> {"A", {"a", "b", "EPSILON"}}; false
+// if the line is not a listing of `kind`.
+bool parseListing(const string& line, const string& kind, string& name, set<string>& items) {
+    const string prefix = kind + "(<";
+    if (line.compare(0, prefix.size(), prefix) != 0) return false;
+    const size_t close = line.find(">)=", prefix.size());
+    const size_t open = line.find('[', close);
+    if (close == string::npos || open == string::npos) return false;
+    name = line.substr(prefix.size(), close - prefix.size());
+    items.clear();
+    size_t i = open + 1;
+    while (i < line.size() && line[i] != ']') {
+        if (line[i] == ',' || isspace(static_cast<unsigned char>(line[i]))) {
+            ++i;
+        } else if (line[i] == '\'') {
+            const size_t end = line.find('\'', i + 1);
+            if (end == string::npos) return false;
+            items.insert(line.substr(i + 1, end - i - 1));
+            i = end + 1;
+        } else {
+            size_t end = i;
+            while (end < line.size() && line[end] != ',' && line[end] != ']' &&
+                   !isspace(static_cast<unsigned char>(line[end]))) {
+                ++end;
+            }
+            items.insert(line.substr(i, end - i));
+            i = end;
+        }
+    }
+    return true;
+}
+
+string listing(const set<string>& items) {
+    string out;
+    for (const auto& s : items) out += (out.empty() ? "" : " ") + s;
+    return "[" + out + "]";
+}
+
+void compareListings(const Grammar& G, const string& kind, const string& path,
+                     const vector<set<string>>& ours, vector<string>& diffs) {
+    ifstream in(path);
+    if (!in) {
+        throw runtime_error("Cannot open " + path);
+    }
+    unordered_map<string, size_t> index;
+    for (size_t A = 0; A < G.nonterms.size(); ++A) index.emplace(G.nonterms[A], A);
+    vector<bool> seen(G.nonterms.size(), false);
+
+    string line, name;
+    set<string> theirs;
+    while (getline(in, line)) {
+        if (!parseListing(trimmed(line), kind, name, theirs)) continue;
+        const auto it = index.find(name);
+        if (it == index.end()) {
+            diffs.push_back(kind + "(<" + name + ">) listed but not in the grammar");
+            continue;
+        }
+        seen[it->second] = true;
+        if (theirs != ours[it->second]) {
+            diffs.push_back(kind + "(<" + name + ">): ours " + listing(ours[it->second]) + ", " +
+                            path + " " + listing(theirs));
+        }
+    }
+    for (size_t A = 0; A < G.nonterms.size(); ++A) {
+        if (!seen[A]) diffs.push_back(kind + "(<" + G.nonterms[A] + ">) missing from " + path);
+    }
+}
+
+}  // namespace
+
+vector<string> compareFirstFollow(const Grammar& G, const LL1Analysis& L,
+                                  const string& firstPath, const string& followPath) {
+    vector<set<string>> first(G.nonterms.size()), follow(G.nonterms.size());
+    for (size_t A = 0; A < G.nonterms.size(); ++A) {
+        for (size_t t = 0; t < G.terms.size(); ++t) {
+            if (L.first[A].test(static_cast<int>(t))) first[A].insert(G.terms[t]);
+            if (L.follow[A].test(static_cast<int>(t))) follow[A].insert(G.terms[t]);
+        }
+        if (L.nullable[A]) first[A].insert("EPSILON");
+    }
+    vector<string> diffs;
+    compareListings(G, "FIRST", firstPath, first, diffs);
+    compareListings(G, "FOLLOW", followPath, follow, diffs);
+    return diffs;
+}
+
+// ---------- Parsing table ----------
+namespace {
+
+string tableTerminalName(const string& lexeme) {
+    static const unordered_map<string, string> punctuation = {
+        {",", "comma"}, {"+", "plus"},    {"-", "minus"},  {"*", "mult"},   {"/", "div"},
+        {"[", "lsqbr"}, {"]", "rsqbr"},   {"(", "lpar"},   {")", "rpar"},   {"{", "lcurbr"},
+        {"}", "rcurbr"}, {";", "semi"},   {":", "colon"},  {".", "dot"},    {"=", "equal"},
+        {"==", "eq"},   {"<>", "neq"},    {"<", "lt"},     {">", "gt"},     {"<=", "leq"},
+        {">=", "geq"},  {"=>", "arrow"},  {"::", "sr"},
+    };
+    const auto it = punctuation.find(lexeme);
+    if (it != punctuation.end()) return it->second;
+    string name = lexeme;
+    for (char& c : name) c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    return name;
+}
+
+string tableNonterminalName(const string& name) {
+    string out;
+    for (char c : name) {
+        if (c != '-') out += static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+    return out;
+}
+
+}  // namespace
+
+Table tableFromGrammar(const Grammar& G, const LL1Analysis& L) {
+    vector<string> terms, nonterms;
+    for (const auto& t : G.terms) terms.push_back(t == "$" ? t : tableTerminalName(t));
+    for (const auto& A : G.nonterms) nonterms.push_back(tableNonterminalName(A));
+
+    vector<vector<string>> productions;
+    for (const auto& p : G.productions) {
+        vector<string> rhs;
+        for (const auto& X : p.rhs) {
+            rhs.push_back(X.terminal ? terms[static_cast<size_t>(X.index)]
+                                     : nonterms[static_cast<size_t>(X.index)]);
+        }
+        if (rhs.empty()) rhs.push_back("EPSILON");
+        productions.push_back(move(rhs));
+    }
+    return assembleTable(terms, nonterms, productions, L.cells);
+}
+
+Table loadGrammarTable(const string& path) {
+    const Grammar G = loadGrammar(path);
+    return tableFromGrammar(G, analyzeLL1(G));
+}
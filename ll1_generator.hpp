@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: ll1_generator.hpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parse_table.hpp"
+
+// ---------- Grammar (.grm) ----------
+// One production per line, as grammartool reads them:
+//   <lhs> ::= <nonterminal> 'terminal' ... | EPSILON
+// Names are kept as written. The first left-hand side is the start symbol.
+struct GrammarSymbol {
+    bool terminal = false;
+    int index = 0;   // into Grammar::terms or Grammar::nonterms
+};
+
+struct Grammar {
+    std::vector<std::string> terms;      // terms[0] is the end marker "$"
+    std::vector<std::string> nonterms;   // nonterms[0] is the start symbol
+    struct Production {
+        int lhs = 0;
+        std::vector<GrammarSymbol> rhs;   // empty for EPSILON
+        int line = 0;
+    };
+    std::vector<Production> productions;
+};
+
+// Throws std::runtime_error on unreadable input or a malformed line.
+Grammar loadGrammar(const std::string& path);
+
+// ---------- FIRST / FOLLOW ----------
+// A set of terminals, one bit per Grammar::terms index.
+class TermSet {
+public:
+    explicit TermSet(std::size_t termCount = 0) : words((termCount + 63) / 64, 0) {}
+
+    void set(int t) { words[static_cast<std::size_t>(t) >> 6] |= std::uint64_t(1) << (t & 63); }
+    bool test(int t) const { return (words[static_cast<std::size_t>(t) >> 6] >> (t & 63)) & 1; }
+    // this |= other; true if a bit was added.
+    bool unite(const TermSet& other) {
+        std::uint64_t added = 0;
+        for (std::size_t w = 0; w < words.size(); ++w) {
+            added |= other.words[w] & ~words[w];
+            words[w] |= other.words[w];
+        }
+        return added != 0;
+    }
+    bool intersects(const TermSet& other) const {
+        for (std::size_t w = 0; w < words.size(); ++w) {
+            if (words[w] & other.words[w]) return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::uint64_t> words;
+};
+
+struct LL1Conflict {
+    int nonterm = 0;
+    int term = 0;
+    std::vector<int> productions;   // every production predicted there, in grammar order
+};
+
+struct LL1Analysis {
+    std::vector<bool> nullable;      // per nonterminal
+    std::vector<TermSet> first;      // per nonterminal, without epsilon
+    std::vector<TermSet> follow;     // per nonterminal
+    std::vector<TermSet> predict;    // per production
+    // nonterms x terms, row-major: the first production predicted, or -1.
+    std::vector<int> cells;
+    std::vector<LL1Conflict> conflicts;
+    int passes = 0;                  // fixpoint sweeps over the productions, all three sets
+};
+
+LL1Analysis analyzeLL1(const Grammar& G);
+
+// "A on 'a': A ::= ... | A ::= ..." for a conflict report.
+std::string describeConflict(const Grammar& G, const LL1Conflict& c);
+std::string productionText(const Grammar& G, int prod);
+
+// Compares the analysis with grammartool's .first / .follow listings
+// (FIRST(<A>)= ['a', EPSILON, ...]). Returns one line per difference;
+// throws std::runtime_error if either file cannot be read.
+std::vector<std::string> compareFirstFollow(const Grammar& G, const LL1Analysis& L,
+                                            const std::string& firstPath, const std::string& followPath);
+
+// ---------- Parsing table ----------
+// The grammar's names in the table's spelling: nonterminals upper-cased
+// without '-' (<rept-idnest1> -> REPTIDNEST1), terminals by token name
+// ('[' -> lsqbr, 'intLit' -> intlit). Conflicting cells keep the first
+// production in grammar order; the driver's lookahead heuristics decide
+// the rest.
+Table tableFromGrammar(const Grammar& G, const LL1Analysis& L);
+
+// loadGrammar + analyzeLL1 + tableFromGrammar.
+Table loadGrammarTable(const std::string& path);
@@ -0,0 +1,735 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parse_table.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#include "parse_table.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "source_buffer.hpp"
+
+using namespace std;
+
+// Our A1 token names vs grammar terminals differ in places.
+// Map them here so the grammar/table stays as the prof expects.
+// loadTable resolves these names to table columns once per token kind; the
+// parser itself only sees the resulting terminal IDs.
+string_view tokToTerm(TokenKind kind) {
+    switch (kind) {
+    // literals
+    case TokenKind::IntNum:   return "intlit";
+    case TokenKind::FloatNum: return "floatlit";
+
+    // identifiers / keywords
+    case TokenKind::Id:       return "id";
+    case TokenKind::Integer:  return "integer";
+    case TokenKind::Float:    return "float";
+    case TokenKind::Void:     return "void";
+    case TokenKind::Class:    return "class";
+    case TokenKind::Return:   return "return";
+    case TokenKind::While:    return "while";
+    case TokenKind::If:       return "if";
+    case TokenKind::Then:     return "then";
+    case TokenKind::Else:     return "else";
+    case TokenKind::Function: return "function";
+    case TokenKind::Constructor: return "constructor";
+    case TokenKind::Attribute: return "attribute";
+    case TokenKind::Public:   return "public";
+    case TokenKind::Private:  return "private";
+    case TokenKind::Read:     return "read";
+    case TokenKind::Write:    return "write";
+    case TokenKind::And:      return "and";
+    case TokenKind::Or:       return "or";
+    case TokenKind::Not:      return "not";
+    case TokenKind::Isa:      return "isa";
+    case TokenKind::Localvar: return "localvar";
+
+    // operators / punctuation (by A1 token name → grammar spelling)
+    case TokenKind::Eq:       return "eq";     // ==
+    case TokenKind::NotEq:    return "neq";    // <>  (grammar says 'neq')
+    case TokenKind::Lt:       return "lt";
+    case TokenKind::Gt:       return "gt";
+    case TokenKind::Leq:      return "leq";
+    case TokenKind::Geq:      return "geq";
+    case TokenKind::ReturnType: return "arrow"; // =>
+    case TokenKind::ScopeOp:  return "sr";     // ::
+    case TokenKind::Assign:   return "equal";  // =
+
+    // Single-char tokens mapped to their literal terminals:
+    case TokenKind::OpenPar:   return "lpar";
+    case TokenKind::ClosePar:  return "rpar";
+    case TokenKind::OpenSqbr:  return "lsqbr";
+    case TokenKind::CloseSqbr: return "rsqbr";
+    case TokenKind::OpenCubr:  return "lcurbr";
+    case TokenKind::CloseCubr: return "rcurbr";
+    case TokenKind::Semi:      return "semi";
+    case TokenKind::Comma:     return "comma";
+    case TokenKind::Colon:     return "colon";
+
+    case TokenKind::Plus:  return "plus";
+    case TokenKind::Minus: return "minus";
+    case TokenKind::Mult:  return "mult";
+    case TokenKind::Div:   return "div";
+
+    // comments are ignored by syntax (the grammar doesn’t include them)
+    case TokenKind::InlineCmt:
+    case TokenKind::BlockCmt: return "__SKIP__";
+
+    // Any lexical error should be surfaced as a non-matching terminal:
+    case TokenKind::InvalidComment:
+    case TokenKind::InvalidId:
+    case TokenKind::InvalidNum:
+    case TokenKind::InvalidChar: return "__LEXERR__";
+
+    // end-of-file sentinel (we’ll push $ at the end)
+    case TokenKind::Eof: return "$";
+
+    // Fallback: try exact lexeme for symbols like "." if ever used
+    case TokenKind::Dot:  return "dot";
+    case TokenKind::Self: return "id";
+
+    case TokenKind::Count: break;
+    }
+    return "__UNKNOWN__";
+}
+
+// ---------- CSV parsing table loader ----------
+static vector<string> splitWS(const string& s) {
+    vector<string> out;
+    string cur; istringstream is(s);
+    while (is >> cur) out.push_back(cur);
+    return out;
+}
+
+static string trimAscii(const string& s) {
+    size_t start = 0;
+    while (start < s.size() && isspace(static_cast<unsigned char>(s[start]))) {
+        ++start;
+    }
+    size_t end = s.size();
+    while (end > start && isspace(static_cast<unsigned char>(s[end - 1]))) {
+        --end;
+    }
+    return s.substr(start, end - start);
+}
+
+static string sanitizeTableCell(string val) {
+    const string arrow = u8"→";
+    const string nbsp = "\xC2\xA0";
+
+    size_t pos = 0;
+    while ((pos = val.find(nbsp, pos)) != string::npos) {
+        val.replace(pos, nbsp.size(), " ");
+    }
+    for (char& ch : val) {
+        if (ch == '\r' || ch == '\t') {
+            ch = ' ';
+        }
+    }
+
+    size_t arrowPos = val.find(arrow);
+    if (arrowPos != string::npos) {
+        val = val.substr(arrowPos + arrow.size());
+    }
+
+    val = trimAscii(val);
+    return val;
+}
+
+static vector<string> splitCsvLine(const string& line) {
+    vector<string> cells;
+    string cell;
+    stringstream ss(line);
+    while (getline(ss, cell, ',')) {
+        if (!cell.empty() && cell.front() == '"' && cell.back() != '"') {
+            string tail;
+            bool closed = false;
+            while (getline(ss, tail, ',')) {
+                cell += ',' + tail;
+                if (!tail.empty() && tail.back() == '"') {
+                    closed = true;
+                    break;
+                }
+            }
+            if (!closed) {
+                throw runtime_error("Malformed CSV line: " + line);
+            }
+        }
+        cells.push_back(cell);
+    }
+    return cells;
+}
+
+int Table::symbolId(string_view name) const {
+    if (indexed) {
+        const auto it = symbolIds.find(name);
+        return it == symbolIds.end() ? -1 : it->second;
+    }
+    const auto it = find(symbols.begin(), symbols.end(), name);
+    return it == symbols.end() ? -1 : static_cast<int>(it - symbols.begin());
+}
+
+int Table::intern(string_view name) {
+    const int found = symbolId(name);
+    if (found >= 0) {
+        return found;
+    }
+    const int id = static_cast<int>(symbols.size());
+    symbols.push_back(ownedNames.emplace_back(name));
+    if (indexed) {
+        symbolIds.emplace(symbols.back(), id);
+    }
+    return id;
+}
+
+int Table::addProduction(const vector<string>& rhs) {
+    const bool epsilon = (rhs.size() == 1 && rhs[0] == kEpsilon);
+    vector<int> syms;
+    for (const auto& sym : rhs) {
+        const int symId = intern(sym);
+        if (!epsilon) {
+            syms.push_back(symId);
+        }
+    }
+    if (indexed) {
+        const auto it = productionIds.find(syms);
+        if (it != productionIds.end()) {
+            return it->second;
+        }
+    } else {
+        for (int p = 0; p < productionCount(); ++p) {
+            if (rhsLength(p) != static_cast<int>(syms.size())) continue;
+            int k = 0;
+            while (k < rhsLength(p) && rhsSymbol(p, k) == syms[static_cast<size_t>(k)]) ++k;
+            if (k == rhsLength(p)) return p;
+        }
+    }
+    const int id = productionCount();
+    for (auto it = syms.rbegin(); it != syms.rend(); ++it) {
+        prodEntries.push_back(stackEntry(*it));
+    }
+    prodStart.push_back(static_cast<uint32_t>(prodEntries.size()));
+    if (indexed) {
+        productionIds.emplace(move(syms), id);
+    }
+    return id;
+}
+
+void Table::buildIndex() {
+    indexed = true;
+    for (size_t id = 0; id < symbols.size(); ++id) {
+        symbolIds.emplace(symbols[id], static_cast<int>(id));
+    }
+    for (int p = 0; p < productionCount(); ++p) {
+        vector<int> syms;
+        for (int k = 0; k < rhsLength(p); ++k) syms.push_back(rhsSymbol(p, k));
+        productionIds.emplace(move(syms), p);
+    }
+}
+
+CombTable CombTable::build(const vector<int16_t>& dense, int rows, int cols) {
+    if (rows > INT16_MAX) {
+        throw runtime_error("Parsing table has more than 32767 nonterminals");
+    }
+    vector<int32_t> base(static_cast<size_t>(rows), 0);
+    vector<int16_t> rowDefault(static_cast<size_t>(rows), -1);
+    vector<int16_t> entryProd, entryRow;
+
+    // Per row: the default, and the columns that differ from it. The
+    // default is the most common value; ties go to -1, then the smallest.
+    vector<vector<int>> entries(static_cast<size_t>(rows));
+    vector<int16_t> sorted(static_cast<size_t>(cols));
+    for (int r = 0; r < rows; ++r) {
+        const int16_t* row = dense.data() + static_cast<size_t>(r) * static_cast<size_t>(cols);
+        sorted.assign(row, row + cols);
+        sort(sorted.begin(), sorted.end());
+        int16_t best = -1;
+        auto bestCount = count(sorted.begin(), sorted.end(), best);
+        for (auto run = sorted.begin(); run != sorted.end();) {
+            const auto runEnd = upper_bound(run, sorted.end(), *run);
+            if (runEnd - run > bestCount) {
+                best = *run;
+                bestCount = runEnd - run;
+            }
+            run = runEnd;
+        }
+        rowDefault[static_cast<size_t>(r)] = best;
+        for (int c = 0; c < cols; ++c) {
+            if (row[c] != best) entries[static_cast<size_t>(r)].push_back(c);
+        }
+    }
+
+    // First fit, densest rows first. Rows may share a displacement as long
+    // as their stored columns do not collide; the row window [base, base +
+    // cols) must lie inside the vector, since lookup reads entryRow there.
+    vector<int> order(static_cast<size_t>(rows));
+    for (int r = 0; r < rows; ++r) order[static_cast<size_t>(r)] = r;
+    stable_sort(order.begin(), order.end(), [&](int x, int y) {
+        return entries[static_cast<size_t>(x)].size() > entries[static_cast<size_t>(y)].size();
+    });
+    for (int r : order) {
+        const vector<int>& rowEntries = entries[static_cast<size_t>(r)];
+        size_t b = 0;
+        auto fits = [&] {
+            for (int c : rowEntries) {
+                const size_t slot = b + static_cast<size_t>(c);
+                if (slot < entryRow.size() && entryRow[slot] >= 0) return false;
+            }
+            return true;
+        };
+        while (!fits()) ++b;
+
+        const size_t end = b + static_cast<size_t>(cols);
+        if (end > entryRow.size()) {
+            entryRow.resize(end, -1);
+            entryProd.resize(end, -1);
+        }
+        base[static_cast<size_t>(r)] = static_cast<int32_t>(b);
+        const int16_t* row = dense.data() + static_cast<size_t>(r) * static_cast<size_t>(cols);
+        for (int c : rowEntries) {
+            entryRow[b + static_cast<size_t>(c)] = static_cast<int16_t>(r);
+            entryProd[b + static_cast<size_t>(c)] = row[c];
+        }
+    }
+    CombTable C;
+    C.base = move(base);
+    C.rowDefault = move(rowDefault);
+    C.entryProd = move(entryProd);
+    C.entryRow = move(entryRow);
+    return C;
+}
+
+CombTable CombTable::view(const Arrays& a) {
+    CombTable C;
+    C.base = TableArray<int32_t>::borrow(a.base, a.rows);
+    C.rowDefault = TableArray<int16_t>::borrow(a.rowDefault, a.rows);
+    C.entryProd = TableArray<int16_t>::borrow(a.entryProd, a.slots);
+    C.entryRow = TableArray<int16_t>::borrow(a.entryRow, a.slots);
+    return C;
+}
+
+size_t CombTable::storedEntries() const {
+    return static_cast<size_t>(count_if(entryRow.begin(), entryRow.end(), [](int16_t r) { return r >= 0; }));
+}
+
+int termIndex(const Table& T, string_view a) {
+    const int id = T.symbolId(a);
+    return id < T.termCount ? id : -1;
+}
+int nontermIndex(const Table& T, string_view A) {
+    const int id = T.symbolId(A);
+    return T.isNonterminal(id) ? id - T.termCount : -1;
+}
+
+Table makeTable(const vector<string>& terms, const vector<string>& nonterms,
+                const vector<vector<string>>& productions, const vector<int>& cells) {
+    Table T;
+    // Terminals and nonterminals take the leading IDs in header/row order
+    // even if a name repeats; lookups by name find the first.
+    for (const auto& names : {&terms, &nonterms}) {
+        for (const auto& name : *names) {
+            T.symbols.push_back(T.ownedNames.emplace_back(name));
+        }
+    }
+    T.termCount = static_cast<int>(terms.size());
+    T.nontermCount = static_cast<int>(nonterms.size());
+    T.buildIndex();
+
+    vector<int> prodOf(productions.size());
+    for (size_t p = 0; p < productions.size(); ++p) {
+        prodOf[p] = T.addProduction(productions[p]);
+    }
+    if (T.productionCount() > INT16_MAX) {
+        throw runtime_error("Parsing table has more than 32767 productions");
+    }
+    vector<int16_t> dense;
+    dense.reserve(cells.size());
+    for (int p : cells) {
+        dense.push_back(static_cast<int16_t>(p < 0 ? -1 : prodOf[static_cast<size_t>(p)]));
+    }
+    T.cells = CombTable::build(dense, T.nontermCount, T.termCount);
+    return T;
+}
+
+// Fills T.kindTerm and T.ids from the header terminals.
+static void resolveTerminals(Table& T) {
+    for (size_t k = 0; k < T.kindTerm.size(); ++k) {
+        const TokenKind kind = static_cast<TokenKind>(k);
+        const string_view name = tokToTerm(kind);
+        int id = kTermUnknown;
+        if (name == "__SKIP__") {
+            id = kTermSkip;
+        } else if (name == "__LEXERR__") {
+            id = kTermLexErr;
+        } else if (name != "__UNKNOWN__") {
+            id = termIndex(T, name);
+            if (id < 0) {
+                cerr << "[WARN] Parsing table has no column for terminal " << name << "\n";
+                id = kTermUnknown;
+            }
+        }
+        T.kindTerm[k] = id;
+    }
+
+    TermIds& ids = T.ids;
+    ids.eof = termIndex(T, "$");
+    if (ids.eof < 0) {
+        throw runtime_error("Parsing table has no \"$\" column");
+    }
+    ids.id = termIndex(T, "id");
+    ids.intlit = termIndex(T, "intlit");
+    ids.dot = termIndex(T, "dot");
+    ids.sr = termIndex(T, "sr");
+    ids.equal = termIndex(T, "equal");
+    ids.lpar = termIndex(T, "lpar");
+    ids.rpar = termIndex(T, "rpar");
+    ids.lsqbr = termIndex(T, "lsqbr");
+    ids.rsqbr = termIndex(T, "rsqbr");
+    ids.plus = termIndex(T, "plus");
+    ids.minus = termIndex(T, "minus");
+    ids.or_ = termIndex(T, "or");
+    ids.mult = termIndex(T, "mult");
+    ids.div = termIndex(T, "div");
+    ids.and_ = termIndex(T, "and");
+    ids.if_ = termIndex(T, "if");
+    ids.while_ = termIndex(T, "while");
+    ids.read = termIndex(T, "read");
+    ids.write = termIndex(T, "write");
+    ids.return_ = termIndex(T, "return");
+    ids.localvar = termIndex(T, "localvar");
+    ids.function = termIndex(T, "function");
+    ids.constructor = termIndex(T, "constructor");
+}
+
+static void printStartRow(const Table& T) {
+    const int start = T.symbolId("START");
+    if (T.isNonterminal(start)) {
+        cerr << "[DEBUG] START row entries:\n";
+        for (int a = 0; a < T.termCount; ++a) {
+            const int p = T.predict(start, a);
+            if (p >= 0) {
+                cerr << "  term " << T.symbols[a] << " -> ";
+                for (const string_view sym : T.rhs(p)) {
+                    cerr << sym << ' ';
+                }
+                cerr << "\n";
+            }
+        }
+    }
+}
+
+Table assembleTable(const vector<string>& terms, const vector<string>& nonterms,
+                    const vector<vector<string>>& productions, const vector<int>& cells) {
+    Table T = makeTable(terms, nonterms, productions, cells);
+    printStartRow(T);
+    resolveTerminals(T);
+    return T;
+}
+
+Table loadCsvTable(const string& path) {
+    ifstream in(path);
+    if (!in) { throw runtime_error("Cannot open parsing_table.csv"); }
+    string line;
+
+    if (!getline(in, line)) throw runtime_error("Empty parsing_table.csv");
+    vector<string> terms;
+    vector<string> headerCells = splitCsvLine(line);
+    if (!headerCells.empty() && !headerCells.front().empty()) {
+        headerCells.insert(headerCells.begin(), "");
+    }
+    for (size_t j = 1; j < headerCells.size(); ++j) {
+        string term = sanitizeTableCell(headerCells[j]);
+        terms.push_back(term);
+    }
+    while (!terms.empty() && terms.back().empty()) {
+        terms.pop_back();
+    }
+
+    const size_t expectedColumns = terms.size() + 1; // include nonterminal column
+
+    vector<string> nonterms;
+    vector<vector<string>> productions;
+    map<vector<string>, int> productionIndex;
+    vector<int> tableCells;
+    while (getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        vector<string> cells = splitCsvLine(line);
+        if (cells.empty()) {
+            continue;
+        }
+        if (cells.size() < expectedColumns) {
+            cells.resize(expectedColumns);
+        }
+
+        string A = sanitizeTableCell(cells[0]);
+        if (A.empty()) {
+            continue;
+        }
+        nonterms.push_back(A); // Store nonterminal
+
+        for (size_t j = 1; j <= terms.size(); ++j) {
+            string val = sanitizeTableCell(cells[j]);
+            if (val == "#" || val.empty()) {
+                tableCells.push_back(-1);
+                continue;
+            }
+            vector<string> rhs = (val == "EPSILON" || val == "&epsilon") ? vector<string>{"EPSILON"}
+                                                                           : splitWS(val);
+            const auto inserted = productionIndex.emplace(rhs, static_cast<int>(productions.size()));
+            if (inserted.second) {
+                productions.push_back(std::move(rhs));
+            }
+            tableCells.push_back(inserted.first->second);
+        }
+    }
+    return assembleTable(terms, nonterms, productions, tableCells);
+}
+
+// ---------- Table image ----------
+TableImage tableImage(const Table& T, vector<uint32_t>& symbolStart, string& pool) {
+    symbolStart.assign(1, 0);
+    pool.clear();
+    for (const string_view name : T.symbols) {
+        pool += name;
+        symbolStart.push_back(static_cast<uint32_t>(pool.size()));
+    }
+    TableImage img;
+    img.termCount = static_cast<uint32_t>(T.termCount);
+    img.nontermCount = static_cast<uint32_t>(T.nontermCount);
+    img.symbolStart = symbolStart.data();
+    img.symbolCount = static_cast<uint32_t>(T.symbols.size());
+    img.prodStart = T.prodStart.data();
+    img.productionCount = static_cast<uint32_t>(T.productionCount());
+    img.prodEntries = reinterpret_cast<const uint32_t*>(T.prodEntries.data());
+    img.entryCount = static_cast<uint32_t>(T.prodEntries.size());
+    img.cells = T.cells.arrays();
+    img.pool = pool.data();
+    img.poolBytes = static_cast<uint32_t>(pool.size());
+    return img;
+}
+
+namespace {
+
+void checkImage(const TableImage& img, const string& origin) {
+    auto corrupt = [&](const char* what) {
+        return runtime_error("Corrupt table " + origin + " (" + what + ")");
+    };
+    if (uint64_t(img.termCount) + img.nontermCount > img.symbolCount ||
+        img.productionCount > uint32_t(INT16_MAX) || img.nontermCount > uint32_t(INT16_MAX) ||
+        img.cells.rows != img.nontermCount) {
+        throw corrupt("bad counts");
+    }
+    for (uint32_t id = 0; id < img.symbolCount; ++id) {
+        if (img.symbolStart[id] > img.symbolStart[id + 1] || img.symbolStart[id + 1] > img.poolBytes) {
+            throw corrupt("bad symbol");
+        }
+    }
+    if (img.prodStart[0] != 0 || img.prodStart[img.productionCount] != img.entryCount) {
+        throw corrupt("bad production");
+    }
+    for (uint32_t p = 0; p < img.productionCount; ++p) {
+        if (img.prodStart[p] > img.prodStart[p + 1]) {
+            throw corrupt("bad production");
+        }
+    }
+    // An entry's tag must be the one Table::stackEntry gives its symbol.
+    for (uint32_t k = 0; k < img.entryCount; ++k) {
+        const StackEntry e{img.prodEntries[k]};
+        const uint32_t sym = static_cast<uint32_t>(e.payload());
+        const bool nonterminal = sym >= img.termCount && sym < img.termCount + img.nontermCount;
+        if (sym >= img.symbolCount ||
+            e.tag() != (nonterminal ? StackTag::Nonterminal : StackTag::Terminal)) {
+            throw corrupt("bad right-hand side");
+        }
+    }
+    const CombTable::Arrays& C = img.cells;
+    const int productions = static_cast<int>(img.productionCount);
+    for (size_t r = 0; r < C.rows; ++r) {
+        if (C.base[r] < 0 || uint64_t(C.base[r]) + img.termCount > C.slots || C.rowDefault[r] < -1 ||
+            C.rowDefault[r] >= productions) {
+            throw corrupt("bad cell");
+        }
+    }
+    for (size_t slot = 0; slot < C.slots; ++slot) {
+        if (C.entryRow[slot] < -1 || C.entryRow[slot] >= static_cast<int>(img.nontermCount) ||
+            (C.entryRow[slot] >= 0 && (C.entryProd[slot] < 0 || C.entryProd[slot] >= productions))) {
+            throw corrupt("bad cell");
+        }
+    }
+}
+
+}  // namespace
+
+Table tableFromImage(const TableImage& img, const string& origin, bool check) {
+    if (check) {
+        checkImage(img, origin);
+    }
+    Table T;
+    T.termCount = static_cast<int>(img.termCount);
+    T.nontermCount = static_cast<int>(img.nontermCount);
+    T.symbols.reserve(img.symbolCount);
+    for (uint32_t id = 0; id < img.symbolCount; ++id) {
+        T.symbols.emplace_back(img.pool + img.symbolStart[id], img.symbolStart[id + 1] - img.symbolStart[id]);
+    }
+    T.prodStart = TableArray<uint32_t>::borrow(img.prodStart, uint64_t(img.productionCount) + 1);
+    T.prodEntries = TableArray<StackEntry>::borrow(reinterpret_cast<const StackEntry*>(img.prodEntries),
+                                                   img.entryCount);
+    T.cells = CombTable::view(img.cells);
+    resolveTerminals(T);
+    return T;
+}
+
+// ---------- Compiled table ----------
+namespace {
+
+struct CompiledTableHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t symbolCount;
+    uint32_t termCount;
+    uint32_t nontermCount;
+    uint32_t productionCount;
+    uint32_t entryCount;
+    uint32_t slotCount;
+    uint32_t poolBytes;
+    uint64_t checksum;
+};
+static_assert(sizeof(CompiledTableHeader) == 48, "compiled table header layout");
+
+template <typename T>
+void appendArray(string& out, const T* values, size_t count) {
+    out.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+}
+
+template <typename T>
+const T* takeArray(const char*& cursor, uint64_t count) {
+    const T* start = reinterpret_cast<const T*>(cursor);
+    cursor += count * sizeof(T);
+    return start;
+}
+
+}  // namespace
+
+uint64_t fnv1a64(string_view bytes) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (unsigned char c : bytes) {
+        h = (h ^ c) * 0x100000001b3ull;
+    }
+    return h;
+}
+
+void writeCompiledTable(const Table& T, const string& path) {
+    vector<uint32_t> symbolStart;
+    string pool;
+    const TableImage img = tableImage(T, symbolStart, pool);
+    string payload;
+    appendArray(payload, img.symbolStart, uint64_t(img.symbolCount) + 1);
+    appendArray(payload, img.prodStart, uint64_t(img.productionCount) + 1);
+    appendArray(payload, img.prodEntries, img.entryCount);
+    appendArray(payload, img.cells.base, img.cells.rows);
+    appendArray(payload, img.cells.rowDefault, img.cells.rows);
+    appendArray(payload, img.cells.entryProd, img.cells.slots);
+    appendArray(payload, img.cells.entryRow, img.cells.slots);
+    appendArray(payload, img.pool, img.poolBytes);
+
+    CompiledTableHeader header{};
+    memcpy(header.magic, kCompiledTableMagic, sizeof(header.magic));
+    header.version = kCompiledTableVersion;
+    header.symbolCount = img.symbolCount;
+    header.termCount = img.termCount;
+    header.nontermCount = img.nontermCount;
+    header.productionCount = img.productionCount;
+    header.entryCount = img.entryCount;
+    header.slotCount = static_cast<uint32_t>(img.cells.slots);
+    header.poolBytes = img.poolBytes;
+    header.checksum = fnv1a64(payload);
+
+    ofstream out(path, ios::binary | ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(payload.data(), static_cast<streamsize>(payload.size()));
+    if (!out) {
+        throw runtime_error("Cannot write compiled table " + path);
+    }
+}
+
+Table loadCompiledTable(const string& path) {
+    auto file = make_shared<io::SourceBuffer>(io::SourceBuffer::open(path));
+    const string_view bytes = file->view();
+    CompiledTableHeader header;
+    if (bytes.size() < sizeof(header)) {
+        throw runtime_error("Truncated compiled table " + path);
+    }
+    memcpy(&header, bytes.data(), sizeof(header));
+    if (memcmp(header.magic, kCompiledTableMagic, sizeof(header.magic)) != 0) {
+        throw runtime_error("Not a compiled table: " + path);
+    }
+    if (header.version != kCompiledTableVersion) {
+        throw runtime_error("Unsupported compiled table version in " + path +
+                            " (rebuild it with --compile-table)");
+    }
+    const uint64_t words = uint64_t(header.symbolCount) + 1 + uint64_t(header.productionCount) + 1 +
+                           header.entryCount + header.nontermCount;
+    const uint64_t halfWords = uint64_t(header.nontermCount) + 2 * uint64_t(header.slotCount);
+    const string_view payload = bytes.substr(sizeof(header));
+    if (payload.size() != words * sizeof(uint32_t) + halfWords * sizeof(int16_t) + header.poolBytes) {
+        throw runtime_error("Corrupt compiled table " + path + " (size mismatch)");
+    }
+    if (fnv1a64(payload) != header.checksum) {
+        throw runtime_error("Corrupt compiled table " + path + " (checksum mismatch)");
+    }
+    // The buffer is page-aligned (heap-aligned if it was read rather than
+    // mapped) and the sections run from the widest elements down, so the
+    // arrays are used in place.
+    const char* cursor = payload.data();
+    TableImage img;
+    img.termCount = header.termCount;
+    img.nontermCount = header.nontermCount;
+    img.symbolCount = header.symbolCount;
+    img.symbolStart = takeArray<uint32_t>(cursor, uint64_t(header.symbolCount) + 1);
+    img.productionCount = header.productionCount;
+    img.prodStart = takeArray<uint32_t>(cursor, uint64_t(header.productionCount) + 1);
+    img.entryCount = header.entryCount;
+    img.prodEntries = takeArray<uint32_t>(cursor, header.entryCount);
+    img.cells.rows = header.nontermCount;
+    img.cells.slots = header.slotCount;
+    img.cells.base = takeArray<int32_t>(cursor, img.cells.rows);
+    img.cells.rowDefault = takeArray<int16_t>(cursor, img.cells.rows);
+    img.cells.entryProd = takeArray<int16_t>(cursor, img.cells.slots);
+    img.cells.entryRow = takeArray<int16_t>(cursor, img.cells.slots);
+    img.poolBytes = header.poolBytes;
+    img.pool = cursor;
+
+    Table T = tableFromImage(img, path, true);
+    T.image = move(file);
+    return T;
+}
+
+Table loadTable(const string& path) {
+    {
+        ifstream probe(path, ios::binary);
+        char magic[sizeof(kCompiledTableMagic)] = {};
+        if (probe.read(magic, sizeof(magic)) &&
+            memcmp(magic, kCompiledTableMagic, sizeof(magic)) == 0) {
+            return loadCompiledTable(path);
+        }
+    }
+    return loadCsvTable(path);
+}
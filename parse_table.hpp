@@ -0,0 +1,375 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parse_table.hpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "include/lexer.hpp"
+
+// ---------- Token -> grammar terminal mapping ----------
+// Our A1 token names vs grammar terminals differ in places; this maps each
+// token kind to the grammar's spelling, or to "__SKIP__" (comments),
+// "__LEXERR__" (invalid tokens) or "__UNKNOWN__".
+std::string_view tokToTerm(TokenKind kind);
+
+// Terminal IDs are the header columns 0..M-1. Tokens the parser never
+// sees get the reserved negative IDs below.
+constexpr int kTermSkip = -1;      // comments
+constexpr int kTermLexErr = -2;    // invalid tokens, reported as lexical errors
+constexpr int kTermUnknown = -3;   // a token kind with no column in the table
+
+// Columns of the terminals the lookahead heuristics test for (-1 if the
+// table has no such column). Reserved words get a trailing underscore.
+struct TermIds {
+    int eof = -1;
+    int id = -1, intlit = -1, dot = -1, sr = -1, equal = -1;
+    int lpar = -1, rpar = -1, lsqbr = -1, rsqbr = -1;
+    int plus = -1, minus = -1, or_ = -1, mult = -1, div = -1, and_ = -1;
+    int if_ = -1, while_ = -1, read = -1, write = -1, return_ = -1;
+    int localvar = -1, function = -1, constructor = -1;
+};
+
+// ---------- Owned or borrowed arrays ----------
+// A read-only array that either owns its elements or borrows them from a
+// loaded image (a mapped compiled table), which must outlive it. Appending
+// to a borrowed array copies it first.
+template <typename T>
+class TableArray {
+public:
+    TableArray() = default;
+    TableArray(std::vector<T> values) : owned(std::move(values)), first(owned.data()), count(owned.size()) {}
+    static TableArray borrow(const T* data, std::size_t size) {
+        TableArray a;
+        a.first = data;
+        a.count = size;
+        a.borrowed = true;
+        return a;
+    }
+
+    TableArray(const TableArray& other)
+        : owned(other.owned), first(other.borrowed ? other.first : owned.data()), count(other.count),
+          borrowed(other.borrowed) {}
+    TableArray(TableArray&&) = default;
+    TableArray& operator=(const TableArray& other) { return *this = TableArray(other); }
+    TableArray& operator=(TableArray&&) = default;
+
+    const T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](std::size_t k) const { return first[k]; }
+    const T& back() const { return first[count - 1]; }
+    const T* begin() const { return first; }
+    const T* end() const { return first + count; }
+    bool isBorrowed() const { return borrowed; }
+
+    void push_back(const T& value) {
+        if (borrowed) {
+            owned.assign(first, first + count);
+            borrowed = false;
+        }
+        owned.push_back(value);
+        first = owned.data();
+        count = owned.size();
+    }
+
+private:
+    std::vector<T> owned;
+    const T* first = nullptr;
+    std::size_t count = 0;
+    bool borrowed = false;
+};
+
+// ---------- Compressed cells ----------
+// Row-displacement ("comb vector") storage for a sparse rows x cols matrix
+// of production IDs. Each row keeps a default (its most common value,
+// either an epsilon production or -1 = no entry) and stores only the other
+// cells, at entry[base[r] + col]. The rows are overlaid into one vector at
+// displacements where they do not collide, and entryRow records which row
+// owns each slot.
+class CombTable {
+public:
+    static CombTable build(const std::vector<std::int16_t>& dense, int rows, int cols);
+
+    // The four arrays, to write the table out or to view a written one.
+    struct Arrays {
+        const std::int32_t* base = nullptr;
+        const std::int16_t* rowDefault = nullptr;
+        std::size_t rows = 0;
+        const std::int16_t* entryProd = nullptr;
+        const std::int16_t* entryRow = nullptr;
+        std::size_t slots = 0;
+    };
+    Arrays arrays() const {
+        return {base.data(), rowDefault.data(), base.size(), entryProd.data(), entryRow.data(), entryProd.size()};
+    }
+    // Borrows `a`'s arrays without copying them.
+    static CombTable view(const Arrays& a);
+
+    int lookup(int row, int col) const {
+        const std::size_t slot = static_cast<std::size_t>(base[static_cast<std::size_t>(row)] + col);
+        return entryRow[slot] == row ? entryProd[slot] : rowDefault[static_cast<std::size_t>(row)];
+    }
+    std::size_t bytes() const {
+        return base.size() * sizeof(base[0]) + rowDefault.size() * sizeof(rowDefault[0]) +
+               entryProd.size() * sizeof(entryProd[0]) + entryRow.size() * sizeof(entryRow[0]);
+    }
+    int defaultOf(int row) const { return rowDefault[static_cast<std::size_t>(row)]; }
+    std::size_t slots() const { return entryProd.size(); }
+    std::size_t storedEntries() const;
+
+private:
+    TableArray<std::int32_t> base;         // per row
+    TableArray<std::int16_t> rowDefault;   // per row
+    TableArray<std::int16_t> entryProd;    // per slot
+    TableArray<std::int16_t> entryRow;     // per slot, -1 = free
+};
+
+// ---------- Parse stack entries ----------
+// A predictive-stack entry in one 32-bit word: a 2-bit tag over a 30-bit
+// payload, the symbol ID for a terminal or nonterminal, or the index of a
+// pending semantic action.
+enum class StackTag : std::uint32_t { Terminal = 0, Nonterminal = 1, Action = 2 };
+
+struct StackEntry {
+    std::uint32_t bits = 0;
+
+    static constexpr StackEntry make(StackTag tag, int payload) {
+        return {(static_cast<std::uint32_t>(tag) << 30) | (static_cast<std::uint32_t>(payload) & kPayloadMask)};
+    }
+    constexpr StackTag tag() const { return static_cast<StackTag>(bits >> 30); }
+    constexpr int payload() const { return static_cast<int>(bits & kPayloadMask); }
+
+    static constexpr std::uint32_t kPayloadMask = (std::uint32_t(1) << 30) - 1;
+};
+static_assert(sizeof(StackEntry) == sizeof(std::uint32_t), "table images store StackEntry bits");
+
+// ---------- LL(1) parsing table ----------
+class RhsNames;
+
+// Spelling of an epsilon production's right-hand side.
+constexpr std::string_view kEpsilon = "EPSILON";
+
+struct Table {
+    Table() = default;
+    Table(Table&&) = default;
+    Table& operator=(Table&&) = default;
+    // The names view ownedNames or the image, so a copy would share them.
+    Table(const Table&) = delete;
+    Table& operator=(const Table&) = delete;
+
+    // Interned grammar symbols. IDs 0..termCount-1 are the header terminals
+    // (a terminal's ID is its column), the next nontermCount IDs are the row
+    // nonterminals in order, and any other symbol named in a right-hand side
+    // (EPSILON, ...) follows them. The names view the compiled image a table
+    // was loaded from, or ownedNames.
+    std::vector<std::string_view> symbols;
+    int termCount = 0;
+    int nontermCount = 0;
+
+    // Production pool, each distinct right-hand side once, as the stack
+    // entries an expansion pushes, last symbol first:
+    // prodEntries[prodStart[p] .. prodStart[p + 1]), none for epsilon.
+    TableArray<std::uint32_t> prodStart{std::vector<std::uint32_t>{0}};
+    TableArray<StackEntry> prodEntries;
+
+    // nontermCount x termCount production IDs, -1 = no entry.
+    CombTable cells;
+
+    // kindTerm[TokenKind] = terminal ID of that token kind.
+    std::array<int, static_cast<std::size_t>(TokenKind::Count)> kindTerm{};
+    TermIds ids;
+
+    // Name lookups scan `symbols` and the pool until buildIndex is called,
+    // which the loaders that build a table by name (CSV, grammar) do.
+    bool indexed = false;
+    std::unordered_map<std::string_view, int> symbolIds;
+    std::map<std::vector<int>, int> productionIds;   // by symbol IDs, none for epsilon
+    std::deque<std::string> ownedNames;
+    // Keeps the mapped file a compiled table's arrays point into alive.
+    std::shared_ptr<const void> image;
+
+    bool isNonterminal(int sym) const { return sym >= termCount && sym < termCount + nontermCount; }
+    // Symbols outside the table (never pushed by its productions) are
+    // tagged as terminals; no token matches them.
+    StackEntry stackEntry(int sym) const {
+        return StackEntry::make(isNonterminal(sym) ? StackTag::Nonterminal : StackTag::Terminal, sym);
+    }
+    // Production for nonterminal symbol `A` on terminal `a`, or -1.
+    int predict(int A, int a) const { return cells.lookup(A - termCount, a); }
+    int productionCount() const { return static_cast<int>(prodStart.size()) - 1; }
+    bool isEpsilon(int prod) const { return prodStart[prod] == prodStart[prod + 1]; }
+    int rhsLength(int prod) const { return static_cast<int>(prodStart[prod + 1] - prodStart[prod]); }
+    // Symbol `k` of production `prod`'s right-hand side, left to right.
+    int rhsSymbol(int prod, int k) const { return prodEntries[prodStart[prod + 1] - 1 - k].payload(); }
+    RhsNames rhs(int prod) const;
+
+    // -1 if `name` was never interned.
+    int symbolId(std::string_view name) const;
+    // Adds a symbol after the existing ones (not a terminal or nonterminal).
+    int intern(std::string_view name);
+    // Reuses an identical right-hand side if there is one.
+    int addProduction(const std::vector<std::string>& rhs);
+    void buildIndex();
+
+    int terminalOf(const Token& t) const { return kindTerm[static_cast<std::size_t>(t.kind)]; }
+    std::string_view termName(int id) const {
+        switch (id) {
+        case kTermSkip: return "__SKIP__";
+        case kTermLexErr: return "__LEXERR__";
+        case kTermUnknown: return "__UNKNOWN__";
+        default: return symbols[static_cast<std::size_t>(id)];
+        }
+    }
+};
+
+// A production's right-hand side as written: the names of its symbols, or
+// kEpsilon alone. Views the table, which must outlive it.
+class RhsNames {
+public:
+    RhsNames(const Table& T, int prod)
+        : names(T.symbols.data()), last(T.prodEntries.data() + T.prodStart[prod + 1]),
+          length(static_cast<std::size_t>(T.rhsLength(prod))) {}
+
+    std::size_t size() const { return length == 0 ? 1 : length; }
+    bool empty() const { return false; }
+    std::string_view operator[](std::size_t k) const {
+        return length == 0 ? kEpsilon : names[static_cast<std::size_t>(last[-1 - static_cast<std::ptrdiff_t>(k)].payload())];
+    }
+    std::string_view front() const { return (*this)[0]; }
+    std::string_view back() const { return (*this)[size() - 1]; }
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        iterator(const RhsNames& r, std::size_t k) : r(&r), k(k) {}
+        std::string_view operator*() const { return (*r)[k]; }
+        iterator& operator++() { ++k; return *this; }
+        bool operator!=(const iterator& other) const { return k != other.k; }
+        bool operator==(const iterator& other) const { return k == other.k; }
+    private:
+        const RhsNames* r;
+        std::size_t k;
+    };
+    iterator begin() const { return {*this, 0}; }
+    iterator end() const { return {*this, size()}; }
+
+    std::vector<std::string> strings() const { return {begin(), end()}; }
+
+private:
+    const std::string_view* names;
+    const StackEntry* last;   // one past the production's first symbol
+    std::size_t length;
+};
+
+inline RhsNames Table::rhs(int prod) const { return RhsNames(*this, prod); }
+
+// Column of terminal `a` / row of nonterminal `A`, or -1.
+int termIndex(const Table& T, std::string_view a);
+int nontermIndex(const Table& T, std::string_view A);
+
+// Loads either format below, telling them apart by the compiled table's
+// magic bytes. Throws std::runtime_error on unreadable or malformed input.
+Table loadTable(const std::string& path);
+
+// CSV format: first row = header terminals (first cell empty).
+// First column = nonterminals. Each cell = RHS symbol list separated by spaces,
+// or "EPSILON", or "#" for empty/no-entry.
+// Example cell: "term addOp arithExprTail"  (spaces separate symbols)
+Table loadCsvTable(const std::string& path);
+
+// ---------- Table image ----------
+// The table as the parser uses it, in arrays a Table can point at without
+// copying. It is the layout of the compiled .tbl file and of the embedded
+// table in parse_table_data.hpp:
+//
+//   symbolStart[symbolCount + 1]     byte offsets into the name pool
+//   prodStart[productionCount + 1]   offsets into prodEntries
+//   prodEntries[entryCount]          Table::prodEntries, StackEntry bits
+//   cells                            Table::cells (CombTable::Arrays)
+//   pool[poolBytes]                  symbol names, not NUL-terminated
+struct TableImage {
+    std::uint32_t termCount = 0;
+    std::uint32_t nontermCount = 0;
+    const std::uint32_t* symbolStart = nullptr;
+    std::uint32_t symbolCount = 0;
+    const std::uint32_t* prodStart = nullptr;
+    std::uint32_t productionCount = 0;
+    const std::uint32_t* prodEntries = nullptr;
+    std::uint32_t entryCount = 0;
+    CombTable::Arrays cells;
+    const char* pool = nullptr;
+    std::uint32_t poolBytes = 0;
+};
+
+// The image of T's arrays. The names are packed into `symbolStart` and
+// `pool`, which must outlive it, as must T.
+TableImage tableImage(const Table& T, std::vector<std::uint32_t>& symbolStart, std::string& pool);
+
+// Points a Table at `img`'s arrays, which must outlive it. With `check`,
+// bounds-checks every offset and ID first; `origin` names the source in
+// error messages.
+Table tableFromImage(const TableImage& img, const std::string& origin, bool check);
+
+// Builds a Table from its header terminals, row nonterminals, candidate
+// right-hand sides and row-major cells indexing into them (-1 = no entry).
+// Throws std::runtime_error if it has more productions than an int16 holds.
+Table makeTable(const std::vector<std::string>& terms, const std::vector<std::string>& nonterms,
+                const std::vector<std::vector<std::string>>& productions, const std::vector<int>& cells);
+
+// makeTable, then what every loader does next: map token kinds to
+// columns (throws if there is no "$" column).
+Table assembleTable(const std::vector<std::string>& terms, const std::vector<std::string>& nonterms,
+                    const std::vector<std::vector<std::string>>& productions, const std::vector<int>& cells);
+
+// ---------- Compiled table (--compile-table) ----------
+// A 48-byte header (magic, version, the counts of the image above and an
+// FNV-1a 64 checksum of the rest) followed by the image's arrays, all
+// host-endian (a foreign-endian file fails the version check):
+//
+//   uint32 symbolStart, prodStart, prodEntries
+//   int32  cells.base
+//   int16  cells.rowDefault, cells.entryProd, cells.entryRow
+//   char   pool
+//
+// Loading one checks it and points a Table at the mapped file.
+// --compile-table writes the table after prepareParserSymbols has added the
+// right-hand sides its overrides use, so a loaded table needs no copy.
+constexpr char kCompiledTableMagic[8] = {'G', '2', 'L', 'L', '1', 'T', 'B', 'L'};
+constexpr std::uint32_t kCompiledTableVersion = 2;
+
+// FNV-1a 64 of `bytes`, the compiled table's checksum.
+std::uint64_t fnv1a64(std::string_view bytes);
+
+void writeCompiledTable(const Table& T, const std::string& path);
+Table loadCompiledTable(const std::string& path);
+
+// ---------- Embedded table ----------
+// The table compiled into the executable from parse_table_data.hpp, which
+// tools/gen_table_header.cpp generates from grammar/parsing_table.csv. The
+// Table points at the generated arrays; nothing is copied or checked.
+Table loadEmbeddedTable();
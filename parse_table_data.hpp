@@ -0,0 +1,164 @@
+// Generated by tools/gen_table_header.cpp from grammar/parsing_table.csv.
+// Do not edit; rerun the generator after changing the table.
+// Layout: see "Table image" in parse_table.hpp.
+
+#pragma once
+
+#include <cstdint>
+
+namespace embedded_table {
+
+inline constexpr char kSource[] = "grammar/parsing_table.csv";
+
+inline constexpr std::uint32_t kTermCount = 48;
+inline constexpr std::uint32_t kNontermCount = 55;
+
+inline constexpr std::uint32_t kSymbolStart[] = {
+    0, 1, 8, 14, 16, 21, 28, 32, 36, 40, 46, 51,
+    55, 60, 64, 68, 70, 76, 82, 87, 91, 95, 100, 103,
+    106, 108, 110, 113, 115, 117, 120, 123, 126, 130, 135, 144,
+    155, 160, 168, 176, 181, 186, 189, 192, 200, 206, 211, 216,
+    218, 223, 230, 241, 250, 259, 267, 277, 286, 304, 308, 314,
+    321, 332, 340, 347, 355, 367, 373, 379, 391, 409, 419, 433,
+    446, 452, 465, 477, 484, 489, 501, 515, 527, 539, 555, 568,
+    585, 596, 613, 631, 649, 659, 673, 686, 699, 709, 726, 738,
+    742, 747, 756, 765, 769, 773, 781, 791, 798,
+};
+
+inline constexpr std::uint32_t kProdStart[] = {
+    0, 1, 2, 3, 5, 5, 7, 9, 12, 13, 16, 23,
+    24, 25, 26, 27, 30, 32, 34, 35, 36, 41, 46, 49,
+    51, 59, 64, 67, 70, 76, 77, 78, 79, 80, 86, 95,
+    101, 102, 103, 104, 107, 109, 112, 113, 114, 115, 116, 117,
+    118, 120, 123, 125, 127, 129, 131, 133, 135, 137, 139, 142,
+    144, 146, 148, 150, 151, 152, 155, 158, 159, 162, 164, 169,
+    174, 179, 185, 194, 196, 197, 198, 199, 202, 203, 204, 205,
+    207, 209, 215, 219, 224, 227, 235, 242,
+};
+
+inline constexpr std::uint32_t kProdEntries[] = {
+    0x00000012, 0x00000013, 0x0000002F, 0x4000004D, 0x40000039, 0x40000039,
+    0x00000015, 0x4000005D, 0x40000063, 0x00000027, 0x0000002C, 0x00000028,
+    0x0000002E, 0x40000039, 0x40000035, 0x40000065, 0x00000006, 0x00000010,
+    0x4000004E, 0x00000011, 0x40000049, 0x00000003, 0x0000002D, 0x4000003E,
+    0x40000037, 0x40000033, 0x40000065, 0x00000007, 0x40000033, 0x00000008,
+    0x4000003A, 0x4000005F, 0x4000003A, 0x0000002A, 0x0000002B, 0x0000002C,
+    0x40000050, 0x4000004F, 0x40000064, 0x00000021, 0x00000003, 0x40000051,
+    0x40000064, 0x00000021, 0x00000003, 0x00000015, 0x00000010, 0x40000052,
+    0x00000011, 0x4000003D, 0x4000003F, 0x4000005C, 0x00000024, 0x00000007,
+    0x4000003B, 0x00000008, 0x00000003, 0x4000004A, 0x00000025, 0x00000007,
+    0x40000031, 0x00000008, 0x00000003, 0x40000053, 0x00000029, 0x40000054,
+    0x00000003, 0x00000027, 0x40000033, 0x00000028, 0x00000006, 0x40000055,
+    0x40000064, 0x00000021, 0x00000003, 0x00000026, 0x40000062, 0x40000043,
+    0x40000047, 0x40000046, 0x00000006, 0x00000007, 0x4000003B, 0x00000008,
+    0x00000021, 0x00000023, 0x00000006, 0x4000005C, 0x00000024, 0x00000007,
+    0x4000003B, 0x00000008, 0x00000021, 0x00000003, 0x00000025, 0x00000006,
+    0x40000056, 0x40000064, 0x00000021, 0x00000003, 0x00000022, 0x0000001E,
+    0x0000001F, 0x00000020, 0x40000057, 0x00000003, 0x0000001D, 0x0000001C,
+    0x00000003, 0x40000033, 0x4000004C, 0x40000033, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001A, 0x0000001B, 0x4000004D, 0x40000032,
+    0x4000004E, 0x40000045, 0x40000066, 0x4000004F, 0x40000034, 0x40000050,
+    0x4000003C, 0x40000051, 0x40000034, 0x40000052, 0x40000044, 0x40000053,
+    0x40000041, 0x40000054, 0x40000042, 0x40000055, 0x40000034, 0x40000056,
+    0x40000034, 0x40000057, 0x00000003, 0x00000015, 0x40000058, 0x40000038,
+    0x40000059, 0x40000062, 0x4000005A, 0x40000041, 0x4000005B, 0x40000042,
+    0x40000064, 0x00000014, 0x4000005D, 0x40000063, 0x40000030, 0x4000005E,
+    0x4000003A, 0x40000048, 0x40000058, 0x00000010, 0x40000059, 0x00000011,
+    0x00000006, 0x40000036, 0x00000006, 0x00000007, 0x40000039, 0x00000008,
+    0x00000009, 0x00000006, 0x00000007, 0x40000039, 0x00000008, 0x0000000A,
+    0x00000006, 0x00000007, 0x40000065, 0x00000008, 0x0000000B, 0x00000006,
+    0x40000061, 0x00000007, 0x4000004B, 0x00000008, 0x0000000C, 0x00000006,
+    0x40000061, 0x0000000D, 0x40000061, 0x0000000E, 0x00000007, 0x4000004B,
+    0x00000008, 0x0000000F, 0x4000005E, 0x4000003A, 0x00000003, 0x00000004,
+    0x00000005, 0x4000005B, 0x00000003, 0x4000005A, 0x00000001, 0x00000002,
+    0x40000040, 0x00000027, 0x00000028, 0x00000006, 0x40000040, 0x00000006,
+    0x40000039, 0x0000002E, 0x00000003, 0x00000029, 0x00000003, 0x00000006,
+    0x40000039, 0x40000035, 0x40000065, 0x00000007, 0x40000031, 0x00000008,
+    0x00000003, 0x00000029, 0x40000054, 0x00000003, 0x00000029, 0x00000006,
+    0x00000007, 0x40000031, 0x00000008, 0x40000064, 0x00000021, 0x00000003,
+    0x00000026, 0x00000007, 0x4000003B, 0x00000008, 0x00000023, 0x0000001C,
+    0x00000003, 0x00000025,
+};
+
+inline constexpr std::int32_t kCombBase[] = {
+    23, 95, 37, 98, 60, 107, 2, 111, 85, 102, 115, 1,
+    162, 3, 158, 162, 10, 198, 162, 165, 116, 52, 114, 170,
+    13, 0, 202, 144, 145, 7, 159, 108, 177, 157, 0, 203,
+    33, 84, 168, 115, 98, 56, 204, 0, 30, 57, 30, 93,
+    155, 82, 170, 147, 104, 208, 175,
+};
+
+inline constexpr std::int16_t kCombDefault[] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1,
+};
+
+inline constexpr std::int16_t kCombProd[] = {
+    -1, -1, -1, 53, 20, 9, 4, 4, 4, 53, 53, 53,
+    53, 25, 4, 53, 4, 4, 4, 4, 22, 4, 4, 4,
+    4, 4, 4, 4, 48, 39, 4, 4, 4, 63, 63, 63,
+    4, 4, 53, 4, 62, 0, 1, 36, 37, 38, 4, 4,
+    4, 4, 64, 4, 4, 4, 4, 4, 4, 4, 5, 60,
+    66, 66, 66, 4, 4, 60, 60, 60, 60, 4, 2, 60,
+    4, 55, 4, 65, 65, 4, 4, 4, 4, 4, 4, 4,
+    4, 29, 31, 32, 4, 32, 4, 29, 29, 29, 29, 4,
+    4, 29, 3, 68, 7, 6, 4, 3, 65, 13, 6, 76,
+    77, 78, 13, 0, 1, 3, 3, 4, 6, 6, 14, 29,
+    13, 13, 11, 15, 56, 29, 29, 29, 29, 4, 12, 29,
+    4, 16, 16, 59, 58, 3, 3, 3, 6, 6, 6, 59,
+    13, 13, 13, 41, 50, 33, 75, 34, 41, 8, 30, 75,
+    10, 17, 18, 19, 49, 49, 41, 41, 4, 75, 75, 42,
+    43, 44, 45, 46, 47, 69, 4, 4, 80, 81, 4, 70,
+    71, 72, 73, 21, 4, 74, 41, 41, 41, 75, 75, 75,
+    67, 49, 49, 23, 49, 52, 51, 24, 67, 26, 27, 28,
+    35, 40, 54, 61, 57, 4, 4, 79, 4, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1,
+};
+
+inline constexpr std::int16_t kCombRow[] = {
+    -1, -1, -1, 34, 11, 6, 43, 43, 11, 34, 34, 34,
+    34, 16, 29, 34, 34, 25, 43, 43, 13, 43, 43, 43,
+    43, 43, 43, 43, 29, 25, 43, 43, 43, 44, 44, 44,
+    46, 46, 34, 43, 43, 0, 0, 24, 24, 24, 43, 43,
+    46, 46, 44, 46, 46, 46, 46, 46, 46, 46, 2, 41,
+    46, 46, 46, 45, 45, 41, 41, 41, 41, 46, 0, 41,
+    41, 36, 36, 45, 45, 46, 45, 45, 45, 45, 45, 45,
+    45, 49, 21, 21, 49, 21, 37, 49, 49, 49, 49, 49,
+    45, 49, 1, 49, 4, 3, 1, 1, 45, 9, 3, 52,
+    52, 52, 9, 47, 47, 1, 1, 31, 3, 3, 10, 20,
+    9, 9, 8, 10, 37, 20, 20, 20, 20, 31, 8, 20,
+    39, 10, 10, 40, 39, 1, 1, 1, 3, 3, 3, 40,
+    9, 9, 9, 27, 31, 22, 51, 22, 27, 5, 20, 51,
+    7, 10, 10, 10, 30, 30, 27, 27, 33, 51, 51, 28,
+    28, 28, 28, 28, 28, 50, 38, 30, 54, 54, 33, 50,
+    50, 50, 50, 12, 32, 50, 27, 27, 27, 51, 51, 51,
+    48, 30, 30, 14, 30, 33, 32, 15, 48, 17, 18, 19,
+    23, 26, 35, 42, 38, 54, 54, 53, 54, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1,
+};
+
+inline constexpr char kPool[] =
+    "$" "private" "public" "id" "float" "integer" "semi" "rpar"
+    "lpar" "return" "write" "read" "while" "else" "then" "if"
+    "rcurbr" "lcurbr" "minus" "plus" "void" "comma" "geq" "leq"
+    "gt" "lt" "neq" "eq" "sr" "isa" "and" "div"
+    "mult" "colon" "attribute" "constructor" "arrow" "function" "localvar" "rsqbr"
+    "lsqbr" "dot" "not" "floatlit" "intlit" "class" "equal" "or"
+    "ADDOP" "APARAMS" "APARAMSTAIL" "ARITHEXPR" "ARRAYSIZE" "ASSIGNOP" "ASSIGNSTAT" "CLASSDECL"
+    "CLASSDECLORFUNCDEF" "EXPR" "FACTOR" "FPARAMS" "FPARAMSTAIL" "FUNCBODY" "FUNCDEF" "FUNCHEAD"
+    "FUNCTIONCALL" "IDNEST" "INDICE" "LOCALVARDECL" "LOCALVARDECLORSTMT" "MEMBERDECL" "MEMBERFUNCDECL" "MEMBERVARDECL"
+    "MULTOP" "OPTCLASSDECL2" "OPTFUNCHEAD1" "RELEXPR" "RELOP" "REPTAPARAMS1" "REPTCLASSDECL4" "REPTFPARAMS3"
+    "REPTFPARAMS4" "REPTFPARAMSTAIL4" "REPTFUNCBODY1" "REPTFUNCTIONCALL0" "REPTIDNEST1" "REPTLOCALVARDECL4" "REPTMEMBERVARDECL4" "REPTOPTCLASSDECL22"
+    "REPTSTART0" "REPTSTATBLOCK1" "REPTVARIABLE0" "REPTVARIABLE2" "RETURNTYPE" "RIGHTRECARITHEXPR" "RIGHTRECTERM" "SIGN"
+    "START" "STATBLOCK" "STATEMENT" "TERM" "TYPE" "VARIABLE" "VISIBILITY" "EPSILON";
+
+}  // namespace embedded_table
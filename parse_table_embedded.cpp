@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parse_table_embedded.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Kept apart from parse_table.cpp so tools/gen_table_header.cpp can link
+// the loaders without the header it generates.
+
+#include "parse_table.hpp"
+#include "parse_table_data.hpp"
+
+#include <iterator>
+
+using namespace std;
+
+namespace {
+
+namespace data = embedded_table;
+
+constexpr size_t kSymbolCount = size(data::kSymbolStart) - 1;
+constexpr size_t kProductionCount = size(data::kProdStart) - 1;
+static_assert(data::kTermCount + data::kNontermCount <= kSymbolCount,
+              "parse_table_data.hpp: more header and row symbols than names");
+static_assert(data::kSymbolStart[kSymbolCount] == size(data::kPool) - 1,
+              "parse_table_data.hpp: symbol offsets do not match the pool");
+static_assert(data::kProdStart[kProductionCount] == size(data::kProdEntries),
+              "parse_table_data.hpp: production offsets do not match the right-hand sides");
+static_assert(size(data::kCombBase) == data::kNontermCount && size(data::kCombDefault) == data::kNontermCount,
+              "parse_table_data.hpp: cell rows do not match the nonterminals");
+static_assert(size(data::kCombProd) == size(data::kCombRow),
+              "parse_table_data.hpp: cell slots do not match");
+
+}  // namespace
+
+Table loadEmbeddedTable() {
+    TableImage img;
+    img.termCount = data::kTermCount;
+    img.nontermCount = data::kNontermCount;
+    img.symbolStart = data::kSymbolStart;
+    img.symbolCount = static_cast<uint32_t>(kSymbolCount);
+    img.prodStart = data::kProdStart;
+    img.productionCount = static_cast<uint32_t>(kProductionCount);
+    img.prodEntries = data::kProdEntries;
+    img.entryCount = static_cast<uint32_t>(size(data::kProdEntries));
+    img.cells.base = data::kCombBase;
+    img.cells.rowDefault = data::kCombDefault;
+    img.cells.rows = data::kNontermCount;
+    img.cells.entryProd = data::kCombProd;
+    img.cells.entryRow = data::kCombRow;
+    img.cells.slots = size(data::kCombProd);
+    img.pool = data::kPool;
+    img.poolBytes = static_cast<uint32_t>(size(data::kPool) - 1);
+    return tableFromImage(img, string("embedded ") + data::kSource, false);
+}
@@ -0,0 +1,265 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parser_decisions.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#include "parser_decisions.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+
+using namespace std;
+
+namespace {
+
+vector<int> rhsSymbols(const Table& PT, int prod) {
+    vector<int> out;
+    for (int k = 0; k < PT.rhsLength(prod); ++k) out.push_back(PT.rhsSymbol(prod, k));
+    return out;
+}
+
+// Fills N.exprLevels from `E` down for as long as each level has the shape
+// described with OperatorLevel. Needs N.cells and N.decisions.
+void findOperatorLevels(const Table& PT, ParserSymbols& N, int E) {
+    while (PT.isNonterminal(E) && N.exprLevels.size() < static_cast<size_t>(PT.nontermCount)) {
+        const vector<int> heads = expansionChoices(PT, N, E);
+        if (heads.size() != 1) break;
+        const vector<int> head = rhsSymbols(PT, heads[0]);
+        if (head.size() != 2 || !PT.isNonterminal(head[0]) || !PT.isNonterminal(head[1])) break;
+        const int next = head[0], tail = head[1];
+        int op = -1;
+        bool chain = true;
+        for (int prod : expansionChoices(PT, N, tail)) {
+            if (PT.isEpsilon(prod)) continue;
+            const vector<int> rhs = rhsSymbols(PT, prod);
+            chain = chain && rhs.size() == 3 && PT.isNonterminal(rhs[0]) && (op < 0 || rhs[0] == op) &&
+                    rhs[1] == next && rhs[2] == tail;
+            if (chain) op = rhs[0];
+        }
+        if (!chain || op < 0) break;
+        for (int prod : expansionChoices(PT, N, op)) {
+            const vector<int> rhs = rhsSymbols(PT, prod);
+            chain = chain && rhs.size() == 1 && !PT.isNonterminal(rhs[0]) && rhs[0] != PT.ids.eof;
+        }
+        if (!chain) break;
+        N.exprLevels.push_back({E, tail, op});
+        E = next;
+    }
+    if (!N.exprLevels.empty()) N.exprOperand = E;
+}
+
+}  // namespace
+
+ParserSymbols prepareParserSymbols(Table& PT, const string& startSym) {
+    ParserSymbols N;
+    N.start = PT.intern(startSym);
+    N.REPTSTART0 = PT.symbolId("REPTSTART0");
+    N.CLASSDECLORFUNCDEF = PT.symbolId("CLASSDECLORFUNCDEF");
+    const int FACTOR = PT.symbolId("FACTOR");
+    const int ARRAYSIZE = PT.symbolId("ARRAYSIZE");
+    const int STATEMENT = PT.symbolId("STATEMENT");
+    const int IDNEST = PT.symbolId("IDNEST");
+    const int REPTVARIABLE0 = PT.symbolId("REPTVARIABLE0");
+    const int REPTVARIABLE2 = PT.symbolId("REPTVARIABLE2");
+    const int REPTVARIABLEORFUNCTIONCALL = PT.symbolId("REPTVARIABLEORFUNCTIONCALL");
+    const int REPTFUNCTIONCALL0 = PT.symbolId("REPTFUNCTIONCALL0");
+    const int RIGHTRECTERM = PT.symbolId("RIGHTRECTERM");
+    const int RIGHTRECARITHEXPR = PT.symbolId("RIGHTRECARITHEXPR");
+    const int REPTSTATBLOCK1 = PT.symbolId("REPTSTATBLOCK1");
+    const int REPTFUNCBODY1 = PT.symbolId("REPTFUNCBODY1");
+    const int LOCALVARDECL = PT.symbolId("LOCALVARDECL");
+    const int OPTFUNCHEAD1 = PT.symbolId("OPTFUNCHEAD1");
+    const int FUNCHEAD = PT.symbolId("FUNCHEAD");
+
+    // Right-hand sides the overrides use instead of table entries.
+    const int epsilon = PT.addProduction({"EPSILON"});
+    const int functionCall = PT.addProduction({"FUNCTIONCALL"});
+    const int variable = PT.addProduction({"VARIABLE"});
+    const int arraySizeInt = PT.addProduction({"lsqbr", "intlit", "rsqbr"});
+    const int arraySizeEmpty = PT.addProduction({"lsqbr", "rsqbr"});
+    const int callStat = PT.addProduction({"FUNCTIONCALL", "semi"});
+    const int memberAssignStat = PT.addProduction({"id", "dot", "id", "equal", "EXPR", "semi"});
+    const int chainedAssignStat = PT.addProduction({"VARIABLE", "ASSIGNOP", "EXPR", "semi"});
+    const int idnestCall = PT.addProduction({"dot", "id", "lpar", "APARAMS", "rpar"});
+    const int idnestMember = PT.addProduction({"dot", "id", "REPTIDNEST1"});
+    const int idnestChain = PT.addProduction({"IDNEST", "REPTFUNCTIONCALL0"});
+    const int localVarCall = PT.addProduction({"localvar", "id", "colon", "TYPE", "lpar", "APARAMS", "rpar", "semi"});
+    const int scopePrefix = PT.addProduction({"id", "sr"});
+    const int constructorHead = PT.addProduction({"function", "id", "sr", "constructor", "lpar", "FPARAMS", "rpar"});
+
+    const TermIds& T = PT.ids;
+    const int M = PT.termCount;
+    vector<int16_t> dense;
+    for (int X = PT.termCount; X < PT.termCount + PT.nontermCount; ++X) {
+        for (int a = 0; a < M; ++a) dense.push_back(static_cast<int16_t>(PT.predict(X, a)));
+    }
+    auto cell = [&](int X, int a) -> int16_t& {
+        return dense[static_cast<size_t>(X - PT.termCount) * static_cast<size_t>(M) + static_cast<size_t>(a)];
+    };
+    auto tableEntry = [&](int X, int a) { return PT.isNonterminal(X) && a >= 0 ? PT.predict(X, a) : -1; };
+
+    // One token decides: the table's entry on the terminals in `keep`,
+    // epsilon on every other.
+    auto epsilonUnless = [&](int X, initializer_list<int> keep) {
+        if (!PT.isNonterminal(X)) return;
+        for (int a = 0; a < M; ++a) {
+            if (find(keep.begin(), keep.end(), a) == keep.end()) cell(X, a) = static_cast<int16_t>(epsilon);
+        }
+    };
+    auto decide = [&](int X, int a, LookaheadDfa dfa) {
+        if (!PT.isNonterminal(X) || a < 0) return;
+        cell(X, a) = static_cast<int16_t>(kDecide - static_cast<int>(N.decisions.size()));
+        N.decisions.push_back(move(dfa));
+    };
+
+    // Rest-of-list nonterminals stop at anything that cannot start another
+    // item. For REPTVARIABLE0 and REPTVARIABLEORFUNCTIONCALL that is any
+    // token but dot: the table expands IDNEST on id, which matches the CSV's
+    // IDNEST -> id REPTIDNEST1 dot rather than the grammar's dot-first one.
+    epsilonUnless(REPTVARIABLE0, {T.dot});
+    epsilonUnless(REPTVARIABLEORFUNCTIONCALL, {T.dot});
+    epsilonUnless(REPTVARIABLE2, {T.lsqbr});
+    epsilonUnless(RIGHTRECTERM, {T.mult, T.div, T.and_});
+    epsilonUnless(RIGHTRECARITHEXPR, {T.plus, T.minus, T.or_});
+    epsilonUnless(REPTSTATBLOCK1, {T.id, T.if_, T.while_, T.read, T.write, T.return_});
+    epsilonUnless(REPTFUNCBODY1, {T.localvar, T.id, T.if_, T.while_, T.read, T.write, T.return_});
+    if (PT.isNonterminal(N.REPTSTART0) && T.eof >= 0) cell(N.REPTSTART0, T.eof) = static_cast<int16_t>(epsilon);
+
+    // FACTOR on id. The CSV has FACTOR -> VARIABLE | FUNCTIONCALL rather
+    // than the grammar's id FACTOR2 ...; it is a call if id(, id[...](,
+    // id.id( or id.id[...]( follows, a variable otherwise.
+    {
+        LookaheadDfa dfa(M, variable);
+        const int member = dfa.addState(variable), afterMember = dfa.addState(variable);
+        dfa.skip(0, T.lsqbr, 0);
+        dfa.choose(0, T.lpar, functionCall);
+        dfa.next(0, T.dot, member);
+        dfa.next(member, T.id, afterMember);
+        dfa.skip(afterMember, T.lsqbr, afterMember);
+        dfa.choose(afterMember, T.lpar, functionCall);
+        decide(FACTOR, T.id, move(dfa));
+    }
+    // ARRAYSIZE on lsqbr: [ intlit ] or [ ].
+    {
+        LookaheadDfa dfa(M, arraySizeEmpty);
+        dfa.choose(0, T.intlit, arraySizeInt);
+        decide(ARRAYSIZE, T.lsqbr, move(dfa));
+    }
+    // STATEMENT on id: the table only has ASSIGNSTAT semi. id( and
+    // id.id[...]( are call statements, id.id = a member assignment and
+    // id.id. a chained one; anything else is left to the table.
+    {
+        const int table = tableEntry(STATEMENT, T.id);
+        LookaheadDfa dfa(M, table);
+        const int member = dfa.addState(table), afterMember = dfa.addState(table);
+        dfa.choose(0, T.lpar, callStat);
+        dfa.next(0, T.dot, member);
+        dfa.next(member, T.id, afterMember);
+        dfa.skip(afterMember, T.lsqbr, afterMember);
+        dfa.choose(afterMember, T.lpar, callStat);
+        dfa.choose(afterMember, T.equal, memberAssignStat);
+        dfa.choose(afterMember, T.dot, chainedAssignStat);
+        decide(STATEMENT, T.id, move(dfa));
+    }
+    // IDNEST on dot, by the grammar's IDNEST -> dot id IDNEST2 (the table's
+    // row is wrong): a method call on dot id (, a member otherwise.
+    {
+        LookaheadDfa dfa(M, tableEntry(IDNEST, T.dot));
+        const int afterId = dfa.addState(idnestMember);
+        dfa.next(0, T.id, afterId);
+        dfa.choose(afterId, T.lpar, idnestCall);
+        decide(IDNEST, T.dot, move(dfa));
+    }
+    // REPTFUNCTIONCALL0 on id: another IDNEST if id[...]. or id(...). follows.
+    {
+        LookaheadDfa dfa(M, epsilon);
+        const int afterCall = dfa.addState(epsilon);
+        dfa.skip(0, T.lsqbr, 0);
+        dfa.choose(0, T.dot, idnestChain);
+        dfa.skip(0, T.lpar, afterCall);
+        dfa.choose(afterCall, T.dot, idnestChain);
+        decide(REPTFUNCTIONCALL0, T.id, move(dfa));
+    }
+    // LOCALVARDECL on localvar: localvar id : TYPE ( is an object declaration.
+    {
+        const int table = tableEntry(LOCALVARDECL, T.localvar);
+        LookaheadDfa dfa(M, table);
+        const int colon = dfa.addState(table), type = dfa.addState(table), afterType = dfa.addState(table);
+        dfa.nextOnAny(0, colon);
+        dfa.nextOnAny(colon, type);
+        dfa.nextOnAny(type, afterType);
+        dfa.choose(afterType, T.lpar, localVarCall);
+        decide(LOCALVARDECL, T.localvar, move(dfa));
+    }
+    // OPTFUNCHEAD1 on id: the Class:: prefix only if sr follows.
+    {
+        LookaheadDfa dfa(M, epsilon);
+        dfa.choose(0, T.sr, scopePrefix);
+        decide(OPTFUNCHEAD1, T.id, move(dfa));
+    }
+    // FUNCHEAD on function: function id sr constructor is a constructor.
+    {
+        const int table = tableEntry(FUNCHEAD, T.function);
+        LookaheadDfa dfa(M, table);
+        const int afterId = dfa.addState(table), afterSr = dfa.addState(table);
+        dfa.next(0, T.id, afterId);
+        dfa.next(afterId, T.sr, afterSr);
+        dfa.choose(afterSr, T.constructor, constructorHead);
+        decide(FUNCHEAD, T.function, move(dfa));
+    }
+
+    N.cells = CombTable::build(dense, PT.nontermCount, M);
+    findOperatorLevels(PT, N, PT.symbolId("ARITHEXPR"));
+    return N;
+}
+
+vector<int> expansionChoices(const Table& PT, const ParserSymbols& N, int X) {
+    vector<int> out;
+    const int row = X - PT.termCount;
+    for (int a = 0; a < PT.termCount; ++a) {
+        const int prod = N.cells.lookup(row, a);
+        if (prod >= 0) {
+            out.push_back(prod);
+        } else if (prod <= kDecide) {
+            N.decisions[static_cast<size_t>(kDecide - prod)].addChoices(out);
+        }
+    }
+    sort(out.begin(), out.end());
+    out.erase(unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+uint64_t decisionFingerprint(const Table& PT, const ParserSymbols& N) {
+    string bytes;
+    auto addWord = [&](uint32_t w) { bytes.append(reinterpret_cast<const char*>(&w), sizeof(w)); };
+    addWord(static_cast<uint32_t>(PT.termCount));
+    addWord(static_cast<uint32_t>(PT.nontermCount));
+    for (const auto& name : PT.symbols) {
+        bytes += name;
+        bytes += '\0';
+    }
+    for (uint32_t w : PT.prodStart) addWord(w);
+    for (int p = 0; p < PT.productionCount(); ++p) {
+        for (int k = 0; k < PT.rhsLength(p); ++k) addWord(static_cast<uint32_t>(PT.rhsSymbol(p, k)));
+    }
+    for (int X = PT.termCount; X < PT.termCount + PT.nontermCount; ++X) {
+        const vector<int> choices = expansionChoices(PT, N, X);
+        addWord(static_cast<uint32_t>(choices.size()));
+        for (int prod : choices) addWord(static_cast<uint32_t>(prod));
+    }
+    addWord(static_cast<uint32_t>(N.exprLevels.size()));
+    for (const OperatorLevel& level : N.exprLevels) {
+        addWord(static_cast<uint32_t>(level.head));
+        addWord(static_cast<uint32_t>(level.tail));
+        addWord(static_cast<uint32_t>(level.op));
+    }
+    addWord(static_cast<uint32_t>(N.exprOperand));
+    return fnv1a64(bytes);
+}
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: parser_decisions.hpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parse_table.hpp"
+
+// ---------- Lookahead decisions ----------
+// A small DFA over the tokens after the lookahead, for the table cells
+// where one token does not pick the production. In each state a terminal
+// either moves to another state and reads the next token, skips the
+// bracketed region it opens (TokenStream::skipBracketed) and moves on from
+// the token after it, or chooses a production (-1 = report no rule).
+// Terminals a state does not list choose its default. Past the last token
+// the DFA reads "$".
+class LookaheadDfa {
+public:
+    LookaheadDfa(int termCount, int choice) : termCount(termCount) { addState(choice); }
+
+    // Adds a state whose unlisted terminals choose `choice`.
+    int addState(int choice) {
+        steps.resize(steps.size() + static_cast<std::size_t>(termCount), {Step::Choose, choice});
+        return states++;
+    }
+    void next(int state, int term, int to) { set(state, term, {Step::Next, to}); }
+    void nextOnAny(int state, int to) {
+        for (int t = 0; t < termCount; ++t) next(state, t, to);
+    }
+    void skip(int state, int term, int to) { set(state, term, {Step::Skip, to}); }
+    void choose(int state, int term, int prod) { set(state, term, {Step::Choose, prod}); }
+
+    // Appends every production some path can choose (not -1).
+    void addChoices(std::vector<int>& out) const {
+        for (const Step& step : steps) {
+            if (step.kind == Step::Choose && step.value >= 0) out.push_back(step.value);
+        }
+    }
+
+    // Runs from state 0 with token `look`. `Input` is the driver's
+    // TokenStream: has(i), operator[](i).term and skipBracketed(i).
+    template <typename Input>
+    int run(Input& input, std::size_t look, int eof) const {
+        int state = 0;
+        while (true) {
+            const int t = input.has(look) ? input[look].term : eof;
+            const Step& step = steps[static_cast<std::size_t>(state) * static_cast<std::size_t>(termCount) +
+                                     static_cast<std::size_t>(t)];
+            switch (step.kind) {
+            case Step::Next:
+                ++look;
+                break;
+            case Step::Skip:
+                look = input.skipBracketed(look);
+                break;
+            case Step::Choose:
+                return step.value;
+            }
+            state = step.value;
+        }
+    }
+
+private:
+    struct Step {
+        enum Kind : std::uint8_t { Next, Skip, Choose } kind;
+        int value;   // next state, or the production chosen
+    };
+    // A terminal the table has no column for (-1) never occurs.
+    void set(int state, int term, Step step) {
+        if (term >= 0) steps[static_cast<std::size_t>(state) * static_cast<std::size_t>(termCount) + static_cast<std::size_t>(term)] = step;
+    }
+
+    int termCount;
+    int states = 0;
+    std::vector<Step> steps;
+};
+
+// ---------- Parser symbols ----------
+// What the parse loop needs from the table, resolved once per table so the
+// loop only compares and indexes integers.
+//
+// The CSV table is not LL(1) for this grammar and gets some rows wrong, so
+// the driver overrides it for about a dozen nonterminals. Overrides that
+// depend on the lookahead alone are folded into `cells`, a copy of the
+// table's cells. The rest are lookahead DFAs, and their cells hold
+// kDecide - d to say "run decisions[d]". Expanding a nonterminal is one
+// cells lookup, plus a DFA run only in a marked cell.
+constexpr int kDecide = -2;
+
+// ---------- Operator levels ----------
+// An expression's binary-operator levels, loosest first, where the table
+// spells them as the usual right-recursive LL(1) chain
+//   E -> T E'    E' -> OP T E' | EPSILON    OP -> op | op ...
+// with T the next level's E and the last level's T the operand. The driver
+// parses such a chain by precedence climbing, one loop per level, instead
+// of expanding every E' and OP on the stack.
+struct OperatorLevel {
+    int head;   // E
+    int tail;   // E'
+    int op;     // OP
+};
+
+struct ParserSymbols {
+    int start = -1;
+    int REPTSTART0 = -1;
+    int CLASSDECLORFUNCDEF = -1;
+    CombTable cells;
+    std::vector<LookaheadDfa> decisions;
+    // ARITHEXPR's operator levels; empty if the table has no such chain.
+    std::vector<OperatorLevel> exprLevels;
+    int exprOperand = -1;
+};
+
+// Resolves the symbols above and builds the overrides. Interns `startSym`
+// and adds the right-hand sides the overrides use to PT's production pool.
+ParserSymbols prepareParserSymbols(Table& PT, const std::string& startSym);
+
+// Every production nonterminal symbol `X` can be expanded with: its cells
+// and the choices of the DFAs they run, ascending.
+std::vector<int> expansionChoices(const Table& PT, const ParserSymbols& N, int X);
+
+// FNV-1a 64 of the symbols, the production pool, every nonterminal's
+// expansionChoices and the operator levels: what code generated from the
+// decisions depends on.
+std::uint64_t decisionFingerprint(const Table& PT, const ParserSymbols& N);
@@ -10,18 +10,23 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <chrono>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
@@ -30,112 +35,34 @@
 #include "include/lexer.hpp"   // your A1 lexer
 #include "ast.hpp"
 #include "ast_factory.hpp"
+#include "derivation_log.hpp"
+#include "ll1_generator.hpp"
+#include "parse_table.hpp"
+#include "parser_decisions.hpp"
+#include "rd_parser_generated.hpp"
 #include "semantic_stack.hpp"
+#include "source_buffer.hpp"
 using namespace std;
 
-// ---------- Token -> grammar terminal mapping ----------
-// Your A1 token names vs grammar terminals differ in places.
-// Map them here so the grammar/table stays as the prof expects.
-static string tokToTerm(const Token& t) {
-    const string& k = t.type;
-    const string& lx = t.lexeme;
-
-    // literals
-    if (k == "intnum")   return "intlit";
-    if (k == "floatnum") return "floatlit";
-
-    // identifiers / keywords
-    if (k == "id")       return "id";
-    if (k == "integer")  return "integer";
-    if (k == "float")    return "float";
-    if (k == "void")     return "void";
-    if (k == "class")    return "class";
-    if (k == "return")   return "return";
-    if (k == "while")    return "while";
-    if (k == "if")       return "if";
-    if (k == "then")     return "then";
-    if (k == "else")     return "else";
-    if (k == "function") return "function";
-    if (k == "constructor") return "constructor";
-    if (k == "attribute") return "attribute";
-    if (k == "public")   return "public";
-    if (k == "private")  return "private";
-    if (k == "read")     return "read";
-    if (k == "write")    return "write";
-    if (k == "and")      return "and";
-    if (k == "or")       return "or";
-    if (k == "not")      return "not";
-    if (k == "isa")      return "isa";
-    if (k == "localvar") return "localvar";
-
-    // operators / punctuation (by A1 token name → grammar spelling)
-    if (k == "eq")       return "eq";     // ==
-    if (k == "noteq")    return "neq";    // <>  (grammar says 'neq')
-    if (k == "lt")       return "lt";
-    if (k == "gt")       return "gt";
-    if (k == "leq")      return "leq";
-    if (k == "geq")      return "geq";
-    if (k == "returntype") return "arrow"; // =>
-    if (k == "scopeop")  return "sr";     // ::
-    if (k == "assign")   return "equal";  // =
-
-    // Single-char tokens mapped to their literal terminals:
-    if (k == "openpar")   return "lpar";
-    if (k == "closepar")  return "rpar";
-    if (k == "opensqbr")  return "lsqbr";
-    if (k == "closesqbr") return "rsqbr";
-    if (k == "opencubr")  return "lcurbr";
-    if (k == "closecubr") return "rcurbr";
-    if (k == "semi")      return "semi";
-    if (k == "comma")     return "comma";
-    if (k == "colon")     return "colon";
-
-    if (k == "plus")  return "plus";
-    if (k == "minus") return "minus";
-    if (k == "mult")  return "mult";
-    if (k == "div")   return "div";
-
-    // comments are ignored by syntax (the grammar doesn’t include them)
-    if (k == "inlinecmt" || k == "blockcmt") return "__SKIP__";
-
-    // Any lexical error should be surfaced as a non-matching terminal:
-    if (k.rfind("invalid",0)==0 || k=="invalidcomment")
-        return "__LEXERR__";
-
-    // end-of-file sentinel (we’ll push $ at the end)
-    if (k == "eof") return "$";
-
-    // Fallback: try exact lexeme for symbols like "." if ever used
-    if (k == "dot") return "dot";
-    if (k == "self") return "id";
-
-    return "__UNKNOWN__";
-}
-
-// ---------- CSV parsing table loader ----------
-// CSV format: first row = header terminals (first cell empty).
-// First column = nonterminals. Each cell = RHS symbol list separated by spaces,
-// or "EPSILON", or "#" for empty/no-entry.
-// Example cell: "term addOp arithExprTail"  (spaces separate symbols)
-struct Table {
-    vector<string> terms;           // header terminals (0..M-1)
-    vector<string> nonterms;        // row nonterminals (0..N-1)
-    // map[row][col] = RHS vector (empty means error).
-    vector<vector<vector<string>>> map;
-};
+// Tokens hold 32-bit offsets into the source; SourceBuffer refuses files
+// they cannot address.
+static_assert(io::kMaxSourceBytes <= numeric_limits<decltype(Token::offset)>::max());
 
 namespace {
 
 using ast::ASTNode;
 using ast::SemanticStack;
 
+// A pending semantic action: the expanded nonterminal's symbol ID and the
+// table production it was expanded with. Names and right-hand sides are
+// read from the table when the action runs.
 struct ActionFrame {
-    string nonterminal;
-    vector<string> rhs;
+    int nonterminal;
+    int production;
 };
 
 struct ChildValue {
-    string symbol;
+    string_view symbol;   // points into the table's production pool
     ASTNode::Ptr node;
 };
 
@@ -147,7 +74,7 @@ ASTNode::Ptr childAt(const vector<ChildValue>& children, size_t index) {
 }
 
 ASTNode::Ptr findChildBySymbol(const vector<ChildValue>& children,
-                               const string& symbol,
+                               string_view symbol,
                                size_t occurrence = 0) {
     size_t count = 0;
     for (const auto& child : children) {
@@ -161,22 +88,10 @@ ASTNode::Ptr findChildBySymbol(const vector<ChildValue>& children,
     return nullptr;
 }
 
-bool isEpsilonSymbol(const string& symbol) {
+bool isEpsilonSymbol(string_view symbol) {
     return symbol == "EPSILON" || symbol == "&epsilon";
 }
 
-string makeActionMarker(int index) {
-    return string("@ACTION") + to_string(index);
-}
-
-bool isActionMarker(const string& symbol) {
-    return symbol.rfind("@ACTION", 0) == 0;
-}
-
-int actionIndexFromMarker(const string& marker) {
-    return stoi(marker.substr(7));
-}
-
 string normalizeTypeName(const string& type) {
     string out;
     out.reserve(type.size());
@@ -188,10 +103,10 @@ string normalizeTypeName(const string& type) {
     return out;
 }
 
-ASTNode::Ptr makeListNode(const string& name,
+ASTNode::Ptr makeListNode(string_view name,
                           const vector<ChildValue>& children,
-                          const vector<string>& rhs) {
-    auto list = make_shared<ASTNode>(name);
+                          const RhsNames& rhs) {
+    auto list = make_shared<ASTNode>(string(name));
     for (size_t i = 0; i < children.size(); ++i) {
         const auto& child = children[i];
         if (!child.node) {
@@ -212,9 +127,9 @@ void logWarn(const string& message) {
     cerr << "[WARN] " << message << "\n";
 }
 
-ASTNode::Ptr makePlaceholder(const string& name,
+ASTNode::Ptr makePlaceholder(string_view name,
                              const vector<ChildValue>& children) {
-    auto node = make_shared<ASTNode>(name);
+    auto node = make_shared<ASTNode>(string(name));
     for (const auto& child : children) {
         if (child.node) {
             node->addChild(child.node);
@@ -223,1036 +138,1099 @@ ASTNode::Ptr makePlaceholder(const string& name,
     return node;
 }
 
-ASTNode::Ptr makeOperatorNode(const string& opType, const string& lexeme, const Token& tok) {
-    ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(lexeme.size())};
+ASTNode::Ptr makeOperatorNode(const string& opType, const string& lexeme, SourcePos pos) {
+    ast::SourceSpan span{pos.line, pos.col, pos.line, pos.col + static_cast<int>(lexeme.size())};
     return make_shared<ASTNode>(opType, lexeme, span);
 }
 
-ASTNode::Ptr createNodeForTerminal(const string& terminal, const Token& tok) {
+// `lexeme` views the lexer's source buffer; it is copied into the node only
+// for terminals that keep their spelling in the AST.
+ASTNode::Ptr createNodeForTerminal(string_view terminal, const Token& tok, SourcePos pos, string_view lexeme) {
+    const ast::SourceSpan lexemeSpan{pos.line, pos.col, pos.line, pos.col + static_cast<int>(lexeme.size())};
     if (terminal == "id") {
-        ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(tok.lexeme.size())};
-        return make_shared<ASTNode>("Identifier", tok.lexeme, span);
+        return make_shared<ASTNode>("Identifier", string(lexeme), lexemeSpan);
     }
     if (terminal == "intlit" || terminal == "intLit") {
-        ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(tok.lexeme.size())};
-        return make_shared<ASTNode>("IntLiteral", tok.lexeme, span);
+        auto node = make_shared<ASTNode>("IntLiteral", string(lexeme), lexemeSpan);
+        if (tok.hasValue) {
+            node->setNumericValue(tok.intValue);
+        }
+        return node;
     }
     if (terminal == "floatlit" || terminal == "floatLit") {
-        ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(tok.lexeme.size())};
-        return make_shared<ASTNode>("FloatLiteral", tok.lexeme, span);
+        auto node = make_shared<ASTNode>("FloatLiteral", string(lexeme), lexemeSpan);
+        if (tok.hasValue) {
+            node->setNumericValue(tok.floatValue);
+        }
+        return node;
     }
     if (terminal == "plus") {
-        return makeOperatorNode("Operator", "+", tok);
+        return makeOperatorNode("Operator", "+", pos);
     }
     if (terminal == "minus") {
-        return makeOperatorNode("Operator", "-", tok);
+        return makeOperatorNode("Operator", "-", pos);
     }
     if (terminal == "mult" || terminal == "*") {
-        return makeOperatorNode("Operator", "*", tok);
+        return makeOperatorNode("Operator", "*", pos);
     }
     if (terminal == "div" || terminal == "/") {
-        return makeOperatorNode("Operator", "/", tok);
+        return makeOperatorNode("Operator", "/", pos);
     }
     if (terminal == "and") {
-        return makeOperatorNode("Operator", "and", tok);
+        return makeOperatorNode("Operator", "and", pos);
     }
     if (terminal == "or") {
-        return makeOperatorNode("Operator", "or", tok);
+        return makeOperatorNode("Operator", "or", pos);
     }
     if (terminal == "not") {
-        return makeOperatorNode("Operator", "not", tok);
+        return makeOperatorNode("Operator", "not", pos);
     }
     if (terminal == "eq") {
-        return makeOperatorNode("Operator", "==", tok);
+        return makeOperatorNode("Operator", "==", pos);
     }
     if (terminal == "neq") {
-        return makeOperatorNode("Operator", "!=", tok);
+        return makeOperatorNode("Operator", "!=", pos);
     }
     if (terminal == "lt") {
-        return makeOperatorNode("Operator", "<", tok);
+        return makeOperatorNode("Operator", "<", pos);
     }
     if (terminal == "gt") {
-        return makeOperatorNode("Operator", ">", tok);
+        return makeOperatorNode("Operator", ">", pos);
     }
     if (terminal == "leq") {
-        return makeOperatorNode("Operator", "<=", tok);
+        return makeOperatorNode("Operator", "<=", pos);
     }
     if (terminal == "geq") {
-        return makeOperatorNode("Operator", ">=", tok);
+        return makeOperatorNode("Operator", ">=", pos);
     }
     if (terminal == "equal") {
-        return makeOperatorNode("Operator", "=", tok);
+        return makeOperatorNode("Operator", "=", pos);
     }
     if (terminal == "class" || terminal == "function" || terminal == "return" || terminal == "while" ||
         terminal == "if" || terminal == "then" || terminal == "else" || terminal == "read" ||
         terminal == "write" || terminal == "public" || terminal == "private" || terminal == "attribute" ||
         terminal == "constructor" || terminal == "localvar") {
-        ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(tok.lexeme.size())};
-        return make_shared<ASTNode>("Keyword", tok.lexeme, span);
+        return make_shared<ASTNode>("Keyword", string(lexeme), lexemeSpan);
     }
     if (terminal == "void" || terminal == "integer" || terminal == "float") {
-        ast::SourceSpan span{tok.line, tok.col, tok.line, tok.col + static_cast<int>(tok.lexeme.size())};
-        return make_shared<ASTNode>("TypeName", tok.lexeme, span);
+        return make_shared<ASTNode>("TypeName", string(lexeme), lexemeSpan);
     }
     return nullptr;
 }
 
-ASTNode::Ptr foldBinaryChain(ASTNode::Ptr left,
-                             const ASTNode::Ptr& chainNode,
-                             const function<ASTNode::Ptr(const string&, ASTNode::Ptr, ASTNode::Ptr)>& makeBinaryFn) {
-    if (!left) {
-        return nullptr;
-    }
-    if (!chainNode) {
-        return left;
-    }
-    const auto& chainChildren = chainNode->getChildren();
-    if (chainChildren.empty()) {
-        return left;
+// Left-folds one operator level into BinaryExpr nodes as its items arrive:
+// operator, operand, operator, operand... Items lost to error recovery are
+// left out and the rest pair up in order, and a level whose first operand
+// is missing has no value.
+class BinaryFold {
+public:
+    explicit BinaryFold(ASTNode::Ptr left) : current(std::move(left)) {}
+
+    void add(ASTNode::Ptr item) {
+        if (!item) {
+            return;
+        }
+        if (!op) {
+            op = std::move(item);
+            return;
+        }
+        if (current) {
+            const auto& opValue = op->getValue();
+            current = ast::makeBinary(opValue ? *opValue : op->getType(), current, std::move(item));
+        }
+        op = nullptr;
     }
-    auto current = left;
-    for (size_t i = 0; i + 1 < chainChildren.size(); i += 2) {
-        const auto& opNode = chainChildren[i];
-        const auto& rhsNode = chainChildren[i + 1];
-        if (!opNode || !rhsNode) {
-            continue;
+    ASTNode::Ptr result() { return std::move(current); }
+
+private:
+    ASTNode::Ptr current;
+    ASTNode::Ptr op;   // waiting for its right operand
+};
+
+// `chainNode` is a RIGHTREC* list: the level's items after `left`.
+ASTNode::Ptr foldBinaryChain(ASTNode::Ptr left, const ASTNode::Ptr& chainNode) {
+    BinaryFold fold(std::move(left));
+    if (chainNode) {
+        for (const auto& item : chainNode->getChildren()) {
+            fold.add(item);
         }
-        const auto& optValue = opNode->getValue();
-        const string opLexeme = optValue ? *optValue : opNode->getType();
-        current = makeBinaryFn(opLexeme, current, rhsNode);
     }
-    return current;
+    return fold.result();
 }
 
-ASTNode::Ptr buildSemanticNode(const ActionFrame& frame, const vector<ChildValue>& children) {
-    const string& nt = frame.nonterminal;
-    const auto& rhs = frame.rhs;
+// ---------- Semantic actions ----------
+// One per nonterminal (or group of nonterminals), building its AST value
+// from the values of the production's right-hand side.
+using SemanticAction = ASTNode::Ptr (*)(string_view nt, const RhsNames& rhs,
+                                        const vector<ChildValue>& children);
 
-    // START ::= PROG eof — wrap translation units in Program root.
-    if (nt == "START") {
-        auto program = make_shared<ASTNode>("Program");
-        auto rootList = childAt(children, 0);
-        if (rootList) {
-            for (const auto& item : rootList->getChildren()) {
-                program->addChild(item);
-            }
+// Nonterminals the driver has no action for keep their children under a
+// node named after them.
+ASTNode::Ptr reducePlaceholder(string_view nt, const RhsNames&, const vector<ChildValue>& children) {
+    return makePlaceholder(nt, children);
+}
+
+// START ::= PROG eof — wrap translation units in Program root.
+ASTNode::Ptr reduceSTART(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto program = make_shared<ASTNode>("Program");
+    auto rootList = childAt(children, 0);
+    if (rootList) {
+        for (const auto& item : rootList->getChildren()) {
+            program->addChild(item);
         }
-        return program;
     }
+    return program;
+}
 
-    // REPTSTART0 — flatten list of translation units.
-    if (nt == "REPTSTART0") {
-        auto list = make_shared<ASTNode>("TranslationUnitList");
-        for (const auto& child : children) {
-            if (child.node) {
-                if (child.node->getType() == "TranslationUnitList") {
-                    for (const auto& grand : child.node->getChildren()) {
-                        list->addChild(grand);
-                    }
-                } else {
-                    list->addChild(child.node);
+// REPTSTART0 — flatten list of translation units.
+ASTNode::Ptr reduceREPTSTART0(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto list = make_shared<ASTNode>("TranslationUnitList");
+    for (const auto& child : children) {
+        if (child.node) {
+            if (child.node->getType() == "TranslationUnitList") {
+                for (const auto& grand : child.node->getChildren()) {
+                    list->addChild(grand);
                 }
+            } else {
+                list->addChild(child.node);
             }
         }
-        return list;
     }
+    return list;
+}
 
-    // CLASSDECLORFUNCDEF ::= CLASSDECL | FUNCDEF — pass through selected child.
-    if (nt == "CLASSDECLORFUNCDEF") {
-        return childAt(children, 0);
-    }
+// CLASSDECLORFUNCDEF ::= CLASSDECL | FUNCDEF — pass through selected child.
+ASTNode::Ptr reduceCLASSDECLORFUNCDEF(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
 
-    // REPTCLASSDECL4 — accumulate class members with optional visibility wrapper.
-    if (nt == "REPTCLASSDECL4") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("MemberList");
-        }
-        auto list = make_shared<ASTNode>("MemberList");
-        auto vis = findChildBySymbol(children, "VISIBILITY");
-        auto member = findChildBySymbol(children, "MEMBERDECL");
-        if (member) {
-            if (vis) {
-                auto wrapper = make_shared<ASTNode>("MemberDecl");
-                wrapper->addChild(vis);
-                wrapper->addChild(member);
-                list->addChild(wrapper);
-            } else {
-                list->addChild(member);
-            }
+// REPTCLASSDECL4 — accumulate class members with optional visibility wrapper.
+ASTNode::Ptr reduceREPTCLASSDECL4(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("MemberList");
+    }
+    auto list = make_shared<ASTNode>("MemberList");
+    auto vis = findChildBySymbol(children, "VISIBILITY");
+    auto member = findChildBySymbol(children, "MEMBERDECL");
+    if (member) {
+        if (vis) {
+            auto wrapper = make_shared<ASTNode>("MemberDecl");
+            wrapper->addChild(vis);
+            wrapper->addChild(member);
+            list->addChild(wrapper);
+        } else {
+            list->addChild(member);
         }
-        if (auto rest = findChildBySymbol(children, "REPTCLASSDECL4")) {
-            for (const auto& more : rest->getChildren()) {
-                list->addChild(more);
-            }
+    }
+    if (auto rest = findChildBySymbol(children, "REPTCLASSDECL4")) {
+        for (const auto& more : rest->getChildren()) {
+            list->addChild(more);
         }
-        return list;
     }
+    return list;
+}
 
-    // VISIBILITY ::= public | private — forward keyword node.
-    if (nt == "VISIBILITY") {
-        return childAt(children, 0);
-    }
+// VISIBILITY ::= public | private — forward keyword node.
+ASTNode::Ptr reduceVISIBILITY(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
 
-    // MEMBERDECL ::= MEMBERFUNCDECL | MEMBERVARDECL — forward built member.
-    if (nt == "MEMBERDECL") {
-        return childAt(children, 0);
-    }
+// MEMBERDECL ::= MEMBERFUNCDECL | MEMBERVARDECL — forward built member.
+ASTNode::Ptr reduceMEMBERDECL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
 
-    // MEMBERVARDECL ::= attribute id : TYPE ... — build VarDecl with dimensions.
-    if (nt == "MEMBERVARDECL") {
-        auto idNode = findChildBySymbol(children, "id");
-        auto typeNode = findChildBySymbol(children, "TYPE");
-        auto var = ast::makeVarDecl(idNode, typeNode);
-        if (auto dims = findChildBySymbol(children, "REPTMEMBERVARDECL4")) {
-            for (const auto& dim : dims->getChildren()) {
-                var->addChild(dim);
-            }
+// MEMBERVARDECL ::= attribute id : TYPE ... — build VarDecl with dimensions.
+ASTNode::Ptr reduceMEMBERVARDECL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto idNode = findChildBySymbol(children, "id");
+    auto typeNode = findChildBySymbol(children, "TYPE");
+    auto var = ast::makeVarDecl(idNode, typeNode);
+    if (auto dims = findChildBySymbol(children, "REPTMEMBERVARDECL4")) {
+        for (const auto& dim : dims->getChildren()) {
+            var->addChild(dim);
         }
-        return var;
     }
+    return var;
+}
 
-    // CLASSDECL ::= class id OPTCLASSDECL2 { REPTCLASSDECL4 } ; — assemble ClassDecl.
-    if (nt == "CLASSDECL") {
-        auto classNode = make_shared<ASTNode>("ClassDecl");
-        auto name = findChildBySymbol(children, "id");
-        if (name) {
-            classNode->addChild(name);
-        }
-        if (auto inherits = findChildBySymbol(children, "OPTCLASSDECL2")) {
-            classNode->addChild(inherits);
-        }
-        if (auto members = findChildBySymbol(children, "REPTCLASSDECL4")) {
-            for (const auto& member : members->getChildren()) {
-                classNode->addChild(member);
-            }
-        }
-        return classNode;
+// CLASSDECL ::= class id OPTCLASSDECL2 { REPTCLASSDECL4 } ; — assemble ClassDecl.
+ASTNode::Ptr reduceCLASSDECL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto classNode = make_shared<ASTNode>("ClassDecl");
+    auto name = findChildBySymbol(children, "id");
+    if (name) {
+        classNode->addChild(name);
     }
-
-    // OPTCLASSDECL2 ::= isa id ... | EPSILON — optional inheritance list.
-    if (nt == "OPTCLASSDECL2") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return nullptr;
-        }
-        auto list = make_shared<ASTNode>("InheritList");
-        auto idNode = findChildBySymbol(children, "id");
-        if (idNode) {
-            list->addChild(idNode);
-        }
-        if (auto tail = findChildBySymbol(children, "REPTOPTCLASSDECL22")) {
-            for (const auto& base : tail->getChildren()) {
-                list->addChild(base);
-            }
+    if (auto inherits = findChildBySymbol(children, "OPTCLASSDECL2")) {
+        classNode->addChild(inherits);
+    }
+    if (auto members = findChildBySymbol(children, "REPTCLASSDECL4")) {
+        for (const auto& member : members->getChildren()) {
+            classNode->addChild(member);
         }
-        return list;
     }
+    return classNode;
+}
 
-    // REPTOPTCLASSDECL22 — gather trailing base classes.
-    if (nt == "REPTOPTCLASSDECL22") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("InheritTail");
-        }
-        auto list = make_shared<ASTNode>("InheritTail");
-        if (auto idNode = findChildBySymbol(children, "id")) {
-            list->addChild(idNode);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTOPTCLASSDECL22")) {
-            for (const auto& node : rest->getChildren()) {
-                list->addChild(node);
-            }
+// OPTCLASSDECL2 ::= isa id ... | EPSILON — optional inheritance list.
+ASTNode::Ptr reduceOPTCLASSDECL2(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return nullptr;
+    }
+    auto list = make_shared<ASTNode>("InheritList");
+    auto idNode = findChildBySymbol(children, "id");
+    if (idNode) {
+        list->addChild(idNode);
+    }
+    if (auto tail = findChildBySymbol(children, "REPTOPTCLASSDECL22")) {
+        for (const auto& base : tail->getChildren()) {
+            list->addChild(base);
         }
-        return list;
     }
+    return list;
+}
 
-    // ASSIGNSTAT — synthesize AssignStmt from VARIABLE and EXPR.
-    if (nt == "ASSIGNSTAT") {
-        auto lhs = findChildBySymbol(children, "VARIABLE");
-        auto rhsExpr = findChildBySymbol(children, "EXPR");
-        return ast::makeAssign(lhs, rhsExpr);
+// REPTOPTCLASSDECL22 — gather trailing base classes.
+ASTNode::Ptr reduceREPTOPTCLASSDECL22(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("InheritTail");
     }
-
-    // STATEMENT — discriminate among assignment, calls, control flow, and IO.
-    if (nt == "STATEMENT") {
-        if (!rhs.empty()) {
-            const string& first = rhs.front();
-            if (first == "ASSIGNSTAT") {
-                return childAt(children, 0);
-            }
-            if (first == "FUNCTIONCALL") {
-                auto callStmt = make_shared<ASTNode>("CallStmt");
-                if (auto call = childAt(children, 0)) {
-                    callStmt->addChild(call);
-                }
-                return callStmt;
-            }
-            if (first == "return") {
-                auto expr = findChildBySymbol(children, "EXPR");
-                auto node = make_shared<ASTNode>("ReturnStmt");
-                if (expr) {
-                    node->addChild(expr);
-                }
-                return node;
-            }
-            if (first == "write") {
-                auto expr = findChildBySymbol(children, "EXPR");
-                auto node = make_shared<ASTNode>("WriteStmt");
-                if (expr) {
-                    node->addChild(expr);
-                }
-                return node;
-            }
-            if (first == "read") {
-                auto varNode = findChildBySymbol(children, "VARIABLE");
-                auto node = make_shared<ASTNode>("ReadStmt");
-                if (varNode) {
-                    node->addChild(varNode);
-                }
-                return node;
-            }
-            if (first == "while") {
-                auto cond = findChildBySymbol(children, "RELEXPR");
-                auto body = findChildBySymbol(children, "STATBLOCK");
-                return ast::makeWhile(cond, body);
-            }
-            if (first == "if") {
-                auto cond = findChildBySymbol(children, "RELEXPR");
-                auto thenBlock = findChildBySymbol(children, "STATBLOCK", 0);
-                auto elseBlock = findChildBySymbol(children, "STATBLOCK", 1);
-                return ast::makeIf(cond, thenBlock, elseBlock);
-            }
+    auto list = make_shared<ASTNode>("InheritTail");
+    if (auto idNode = findChildBySymbol(children, "id")) {
+        list->addChild(idNode);
+    }
+    if (auto rest = findChildBySymbol(children, "REPTOPTCLASSDECL22")) {
+        for (const auto& node : rest->getChildren()) {
+            list->addChild(node);
         }
-        // Fallback: return first child if no specific case matched
-        return childAt(children, 0);
     }
+    return list;
+}
 
-    // STATBLOCK — normalize block forms into Block node.
-    if (nt == "STATBLOCK") {
-        if (rhs.size() == 1 && rhs.front() == "STATEMENT") {
+// ASSIGNSTAT — synthesize AssignStmt from VARIABLE and EXPR.
+ASTNode::Ptr reduceASSIGNSTAT(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto lhs = findChildBySymbol(children, "VARIABLE");
+    auto rhsExpr = findChildBySymbol(children, "EXPR");
+    return ast::makeAssign(lhs, rhsExpr);
+}
+
+// STATEMENT — discriminate among assignment, calls, control flow, and IO.
+ASTNode::Ptr reduceSTATEMENT(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (!rhs.empty()) {
+        const string_view first = rhs.front();
+        if (first == "ASSIGNSTAT") {
             return childAt(children, 0);
         }
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("Block");
-        }
-        auto block = make_shared<ASTNode>("Block");
-        auto stmts = findChildBySymbol(children, "REPTSTATBLOCK1");
-        if (stmts) {
-            for (const auto& stmt : stmts->getChildren()) {
-                block->addChild(stmt);
+        if (first == "FUNCTIONCALL") {
+            auto callStmt = make_shared<ASTNode>("CallStmt");
+            if (auto call = childAt(children, 0)) {
+                callStmt->addChild(call);
             }
+            return callStmt;
         }
-        return block;
-    }
-
-    // FUNCBODY ::= { REPTFUNCBODY1 } — materialize Block from local decls/stmts.
-    if (nt == "FUNCBODY") {
-        auto block = make_shared<ASTNode>("Block");
-        auto seq = findChildBySymbol(children, "REPTFUNCBODY1");
-        if (seq) {
-            for (const auto& stmt : seq->getChildren()) {
-                block->addChild(stmt);
+        if (first == "return") {
+            auto expr = findChildBySymbol(children, "EXPR");
+            auto node = make_shared<ASTNode>("ReturnStmt");
+            if (expr) {
+                node->addChild(expr);
             }
+            return node;
         }
-        return block;
-    }
-
-    // FUNCDEF ::= FUNCHEAD FUNCBODY — pair declaration with body.
-    if (nt == "FUNCDEF") {
-        auto decl = findChildBySymbol(children, "FUNCHEAD");
-        auto body = findChildBySymbol(children, "FUNCBODY");
-        return ast::makeFuncDef(decl, body);
-    }
-
-    // FUNCHEAD — build FunctionDecl with params and return type.
-    if (nt == "FUNCHEAD") {
-        auto funcDecl = make_shared<ASTNode>("FunctionDecl");
-        
-        // Check for scope resolution (Class::method)
-        if (auto scope = findChildBySymbol(children, "OPTFUNCHEAD1")) {
-            funcDecl->addChild(scope);
-        }
-        
-        // Add function name
-        auto nameNode = findChildBySymbol(children, "id", 0);
-        if (nameNode) {
-            funcDecl->addChild(nameNode);
+        if (first == "write") {
+            auto expr = findChildBySymbol(children, "EXPR");
+            auto node = make_shared<ASTNode>("WriteStmt");
+            if (expr) {
+                node->addChild(expr);
+            }
+            return node;
         }
-        
-        // Add parameters
-        auto paramsNode = findChildBySymbol(children, "FPARAMS");
-        if (paramsNode) {
-            for (const auto& param : paramsNode->getChildren()) {
-                funcDecl->addChild(param);
+        if (first == "read") {
+            auto varNode = findChildBySymbol(children, "VARIABLE");
+            auto node = make_shared<ASTNode>("ReadStmt");
+            if (varNode) {
+                node->addChild(varNode);
             }
+            return node;
+        }
+        if (first == "while") {
+            auto cond = findChildBySymbol(children, "RELEXPR");
+            auto body = findChildBySymbol(children, "STATBLOCK");
+            return ast::makeWhile(cond, body);
         }
-        
-        // Add return type
-        auto returnType = findChildBySymbol(children, "RETURNTYPE");
-        if (returnType) {
-            funcDecl->addChild(returnType);
+        if (first == "if") {
+            auto cond = findChildBySymbol(children, "RELEXPR");
+            auto thenBlock = findChildBySymbol(children, "STATBLOCK", 0);
+            auto elseBlock = findChildBySymbol(children, "STATBLOCK", 1);
+            return ast::makeIf(cond, thenBlock, elseBlock);
         }
-        
-        return funcDecl;
     }
+    // Fallback: return first child if no specific case matched
+    return childAt(children, 0);
+}
 
-    // Forward simple terminals/nonterminals that already yield AST terminals.
-    if (nt == "RETURNTYPE" || nt == "TYPE" || nt == "ASSIGNOP" || nt == "ADDOP" ||
-        nt == "MULTOP" || nt == "SIGN" || nt == "RELOP") {
+// STATBLOCK — normalize block forms into Block node.
+ASTNode::Ptr reduceSTATBLOCK(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && rhs.front() == "STATEMENT") {
         return childAt(children, 0);
     }
-
-    // EXPR — expression nodes already built by child.
-    if (nt == "EXPR") {
-        return childAt(children, 0);
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("Block");
     }
-
-    // RELEXPR ::= ARITHEXPR RELOP ARITHEXPR — binary comparison.
-    if (nt == "RELEXPR") {
-        auto left = findChildBySymbol(children, "ARITHEXPR", 0);
-        auto opNode = findChildBySymbol(children, "RELOP");
-        auto right = findChildBySymbol(children, "ARITHEXPR", 1);
-        const string op = (opNode && opNode->getValue()) ? *opNode->getValue() : (opNode ? opNode->getType() : "");
-        return ast::makeBinary(op, left, right);
+    auto block = make_shared<ASTNode>("Block");
+    auto stmts = findChildBySymbol(children, "REPTSTATBLOCK1");
+    if (stmts) {
+        for (const auto& stmt : stmts->getChildren()) {
+            block->addChild(stmt);
+        }
     }
+    return block;
+}
 
-    // ARITHEXPR ::= TERM RIGHTRECARITHEXPR — fold additive chain.
-    if (nt == "ARITHEXPR") {
-        auto left = findChildBySymbol(children, "TERM");
-        auto tail = findChildBySymbol(children, "RIGHTRECARITHEXPR");
-        return foldBinaryChain(left, tail, [](const string& op, ASTNode::Ptr l, ASTNode::Ptr r) {
-            return ast::makeBinary(op, l, r);
-        });
+// FUNCBODY ::= { REPTFUNCBODY1 } — materialize Block from local decls/stmts.
+ASTNode::Ptr reduceFUNCBODY(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto block = make_shared<ASTNode>("Block");
+    auto seq = findChildBySymbol(children, "REPTFUNCBODY1");
+    if (seq) {
+        for (const auto& stmt : seq->getChildren()) {
+            block->addChild(stmt);
+        }
     }
+    return block;
+}
 
-    // TERM ::= FACTOR RIGHTRECTERM — fold multiplicative chain.
-    if (nt == "TERM") {
-        auto left = findChildBySymbol(children, "FACTOR");
-        auto tail = findChildBySymbol(children, "RIGHTRECTERM");
-        return foldBinaryChain(left, tail, [](const string& op, ASTNode::Ptr l, ASTNode::Ptr r) {
-            return ast::makeBinary(op, l, r);
-        });
-    }
+// FUNCDEF ::= FUNCHEAD FUNCBODY — pair declaration with body.
+ASTNode::Ptr reduceFUNCDEF(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto decl = findChildBySymbol(children, "FUNCHEAD");
+    auto body = findChildBySymbol(children, "FUNCBODY");
+    return ast::makeFuncDef(decl, body);
+}
 
-    // RIGHTREC* — accumulate operator RHS pairs for folding.
-    if (nt == "RIGHTRECARITHEXPR" || nt == "RIGHTRECTERM") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>(nt);
-        }
-        auto list = make_shared<ASTNode>(nt);
-        if (!children.empty() && children[0].node) {
-            list->addChild(children[0].node);
-        }
-        if (children.size() > 1 && children[1].node) {
-            list->addChild(children[1].node);
-        }
-        if (children.size() > 2 && children[2].node) {
-            if (children[2].node->getType() == nt) {
-                for (const auto& ch : children[2].node->getChildren()) {
-                    list->addChild(ch);
-                }
-            } else {
-                list->addChild(children[2].node);
+// FUNCHEAD — build FunctionDecl with params and return type.
+ASTNode::Ptr reduceFUNCHEAD(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto funcDecl = make_shared<ASTNode>("FunctionDecl");
+    
+    // Check for scope resolution (Class::method)
+    if (auto scope = findChildBySymbol(children, "OPTFUNCHEAD1")) {
+        funcDecl->addChild(scope);
+    }
+    
+    // Add function name
+    auto nameNode = findChildBySymbol(children, "id", 0);
+    if (nameNode) {
+        funcDecl->addChild(nameNode);
+    }
+    
+    // Add parameters
+    auto paramsNode = findChildBySymbol(children, "FPARAMS");
+    if (paramsNode) {
+        for (const auto& param : paramsNode->getChildren()) {
+            funcDecl->addChild(param);
+        }
+    }
+    
+    // Add return type
+    auto returnType = findChildBySymbol(children, "RETURNTYPE");
+    if (returnType) {
+        funcDecl->addChild(returnType);
+    }
+    
+    return funcDecl;
+}
+
+// Forward simple terminals/nonterminals that already yield AST terminals.
+ASTNode::Ptr reducePassThrough(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
+
+// EXPR — expression nodes already built by child.
+ASTNode::Ptr reduceEXPR(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
+
+// RELEXPR ::= ARITHEXPR RELOP ARITHEXPR — binary comparison.
+ASTNode::Ptr reduceRELEXPR(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto left = findChildBySymbol(children, "ARITHEXPR", 0);
+    auto opNode = findChildBySymbol(children, "RELOP");
+    auto right = findChildBySymbol(children, "ARITHEXPR", 1);
+    const string op = (opNode && opNode->getValue()) ? *opNode->getValue() : (opNode ? opNode->getType() : "");
+    return ast::makeBinary(op, left, right);
+}
+
+// ARITHEXPR ::= TERM RIGHTRECARITHEXPR — fold additive chain.
+ASTNode::Ptr reduceARITHEXPR(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto left = findChildBySymbol(children, "TERM");
+    auto tail = findChildBySymbol(children, "RIGHTRECARITHEXPR");
+    return foldBinaryChain(left, tail);
+}
+
+// TERM ::= FACTOR RIGHTRECTERM — fold multiplicative chain.
+ASTNode::Ptr reduceTERM(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto left = findChildBySymbol(children, "FACTOR");
+    auto tail = findChildBySymbol(children, "RIGHTRECTERM");
+    return foldBinaryChain(left, tail);
+}
+
+// RIGHTREC* — accumulate operator RHS pairs for folding.
+ASTNode::Ptr reduceRIGHTREC(string_view nt, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>(string(nt));
+    }
+    auto list = make_shared<ASTNode>(string(nt));
+    if (!children.empty() && children[0].node) {
+        list->addChild(children[0].node);
+    }
+    if (children.size() > 1 && children[1].node) {
+        list->addChild(children[1].node);
+    }
+    if (children.size() > 2 && children[2].node) {
+        if (children[2].node->getType() == nt) {
+            for (const auto& ch : children[2].node->getChildren()) {
+                list->addChild(ch);
             }
+        } else {
+            list->addChild(children[2].node);
         }
-        return list;
     }
+    return list;
+}
 
-    // FACTEXPR — collapse helper nonterminal to the meaningful child node.
-    if (nt == "FACTEXPR") {
-        if (auto call = findChildBySymbol(children, "FUNCTIONCALL")) {
-            return call;
-        }
-        if (auto variable = findChildBySymbol(children, "VARIABLE")) {
-            return variable;
+// FACTEXPR — collapse helper nonterminal to the meaningful child node.
+ASTNode::Ptr reduceFACTEXPR(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (auto call = findChildBySymbol(children, "FUNCTIONCALL")) {
+        return call;
+    }
+    if (auto variable = findChildBySymbol(children, "VARIABLE")) {
+        return variable;
+    }
+    if (!rhs.empty() && rhs.front() == "lpar") {
+        if (auto expr = findChildBySymbol(children, "EXPR")) {
+            return expr;
         }
-        if (!rhs.empty() && rhs.front() == "lpar") {
-            if (auto expr = findChildBySymbol(children, "EXPR")) {
-                return expr;
-            }
+    }
+    for (const auto& child : children) {
+        if (!child.node) {
+            continue;
         }
-        for (const auto& child : children) {
-            if (!child.node) {
-                continue;
-            }
-            if (child.symbol == "lpar" || child.symbol == "rpar") {
-                continue;
-            }
-            return child.node;
+        if (child.symbol == "lpar" || child.symbol == "rpar") {
+            continue;
         }
-        return nullptr;
+        return child.node;
     }
+    return nullptr;
+}
 
-    // FACTOR — resolve literals, parenthesized, unary, calls, and variables.
-    if (nt == "FACTOR") {
-        if (rhs.size() == 1) {
-            return childAt(children, 0);
-        }
-        if (rhs.size() == 3 && rhs.front() == "lpar") {
-            return findChildBySymbol(children, "ARITHEXPR");
-        }
-        if (rhs.size() == 2 && rhs.front() == "SIGN") {
-            auto signNode = childAt(children, 0);
-            auto operand = childAt(children, 1);
-            const string sign = (signNode && signNode->getValue()) ? *signNode->getValue() : (signNode ? signNode->getType() : "+");
-            return ast::makeUnary(sign, operand);
-        }
-        if (rhs.size() == 2 && rhs.front() == "not") {
-            auto operand = childAt(children, 1);
-            return ast::makeUnary("not", operand);
-        }
-        if (rhs.front() == "FUNCTIONCALL") {
-            return childAt(children, 0);
-        }
-        if (rhs.front() == "VARIABLE") {
-            return childAt(children, 0);
-        }
+// FACTOR — resolve literals, parenthesized, unary, calls, and variables.
+ASTNode::Ptr reduceFACTOR(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1) {
         return childAt(children, 0);
     }
-
-    // REPTFUNCBODY1 — sequence of LOCALVARDECLORSTMT nodes.
-    if (nt == "REPTFUNCBODY1") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("StmtList");
-        }
-        auto list = make_shared<ASTNode>("StmtList");
-        if (auto item = findChildBySymbol(children, "LOCALVARDECLORSTMT")) {
-            list->addChild(item);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTFUNCBODY1")) {
-            for (const auto& stmt : rest->getChildren()) {
-                list->addChild(stmt);
-            }
-        }
-        return list;
+    if (rhs.size() == 3 && rhs.front() == "lpar") {
+        return findChildBySymbol(children, "ARITHEXPR");
+    }
+    if (rhs.size() == 2 && rhs.front() == "SIGN") {
+        auto signNode = childAt(children, 0);
+        auto operand = childAt(children, 1);
+        const string sign = (signNode && signNode->getValue()) ? *signNode->getValue() : (signNode ? signNode->getType() : "+");
+        return ast::makeUnary(sign, operand);
     }
+    if (rhs.size() == 2 && rhs.front() == "not") {
+        auto operand = childAt(children, 1);
+        return ast::makeUnary("not", operand);
+    }
+    if (rhs.front() == "FUNCTIONCALL") {
+        return childAt(children, 0);
+    }
+    if (rhs.front() == "VARIABLE") {
+        return childAt(children, 0);
+    }
+    return childAt(children, 0);
+}
 
-    // REPTSTATBLOCK1 — sequence of STATEMENT nodes.
-    if (nt == "REPTSTATBLOCK1") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("StmtList");
-        }
-        auto list = make_shared<ASTNode>("StmtList");
-        if (auto stmt = findChildBySymbol(children, "STATEMENT")) {
+// REPTFUNCBODY1 — sequence of LOCALVARDECLORSTMT nodes.
+ASTNode::Ptr reduceREPTFUNCBODY1(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("StmtList");
+    }
+    auto list = make_shared<ASTNode>("StmtList");
+    if (auto item = findChildBySymbol(children, "LOCALVARDECLORSTMT")) {
+        list->addChild(item);
+    }
+    if (auto rest = findChildBySymbol(children, "REPTFUNCBODY1")) {
+        for (const auto& stmt : rest->getChildren()) {
             list->addChild(stmt);
         }
-        if (auto rest = findChildBySymbol(children, "REPTSTATBLOCK1")) {
-            for (const auto& ch : rest->getChildren()) {
-                list->addChild(ch);
-            }
-        }
-        return list;
     }
+    return list;
+}
 
-    // LOCALVARDECLORSTMT — pass through alt (local var or statement).
-    if (nt == "LOCALVARDECLORSTMT") {
-        return childAt(children, 0);
+// REPTSTATBLOCK1 — sequence of STATEMENT nodes.
+ASTNode::Ptr reduceREPTSTATBLOCK1(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("StmtList");
     }
-
-    // LOCALVARDECL ::= localvar id : TYPE ARRAYOROBJECT — build VarDecl with init/dims.
-    if (nt == "LOCALVARDECL") {
-        auto idNode = findChildBySymbol(children, "id");
-        auto typeNode = findChildBySymbol(children, "TYPE");
-        ASTNode::Ptr init;
-        if (auto params = findChildBySymbol(children, "APARAMS")) {
-            init = make_shared<ASTNode>("InitializerCall");
-            for (const auto& arg : params->getChildren()) {
-                init->addChild(arg);
-            }
-        }
-        auto varDecl = ast::makeVarDecl(idNode, typeNode, init);
-        if (auto dims = findChildBySymbol(children, "REPTLOCALVARDECL4")) {
-            for (const auto& dim : dims->getChildren()) {
-                varDecl->addChild(dim);
-            }
+    auto list = make_shared<ASTNode>("StmtList");
+    if (auto stmt = findChildBySymbol(children, "STATEMENT")) {
+        list->addChild(stmt);
+    }
+    if (auto rest = findChildBySymbol(children, "REPTSTATBLOCK1")) {
+        for (const auto& ch : rest->getChildren()) {
+            list->addChild(ch);
         }
-        return varDecl;
     }
+    return list;
+}
 
-    // VARIABLE — compose nested id/indices chain.
-    if (nt == "VARIABLE") {
-        auto node = make_shared<ASTNode>("Variable");
-        auto prefix = findChildBySymbol(children, "REPTVARIABLE0");
-        if (prefix) {
-            for (const auto& ch : prefix->getChildren()) {
-                node->addChild(ch);
-            }
-        }
-        auto idNode = findChildBySymbol(children, "id");
-        if (idNode) {
-            node->addChild(idNode);
+// LOCALVARDECLORSTMT — pass through alt (local var or statement).
+ASTNode::Ptr reduceLOCALVARDECLORSTMT(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    return childAt(children, 0);
+}
+
+// LOCALVARDECL ::= localvar id : TYPE ARRAYOROBJECT — build VarDecl with init/dims.
+ASTNode::Ptr reduceLOCALVARDECL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto idNode = findChildBySymbol(children, "id");
+    auto typeNode = findChildBySymbol(children, "TYPE");
+    ASTNode::Ptr init;
+    if (auto params = findChildBySymbol(children, "APARAMS")) {
+        init = make_shared<ASTNode>("InitializerCall");
+        for (const auto& arg : params->getChildren()) {
+            init->addChild(arg);
         }
-        auto suffix = findChildBySymbol(children, "REPTVARIABLE2");
-        if (suffix) {
-            for (const auto& ch : suffix->getChildren()) {
-                node->addChild(ch);
-            }
+    }
+    auto varDecl = ast::makeVarDecl(idNode, typeNode, init);
+    if (auto dims = findChildBySymbol(children, "REPTLOCALVARDECL4")) {
+        for (const auto& dim : dims->getChildren()) {
+            varDecl->addChild(dim);
         }
-        return node;
     }
+    return varDecl;
+}
 
-    // FUNCTIONCALL — build CallExpr with optional prefix chain and arguments.
-    if (nt == "FUNCTIONCALL") {
-        auto call = make_shared<ASTNode>("FunctionCall");
-        
-        // Add prefix member access chain if present
-        if (auto prefix = findChildBySymbol(children, "REPTFUNCTIONCALL0")) {
-            for (const auto& nest : prefix->getChildren()) {
-                call->addChild(nest);
-            }
+// VARIABLE — compose nested id/indices chain.
+ASTNode::Ptr reduceVARIABLE(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto node = make_shared<ASTNode>("Variable");
+    auto prefix = findChildBySymbol(children, "REPTVARIABLE0");
+    if (prefix) {
+        for (const auto& ch : prefix->getChildren()) {
+            node->addChild(ch);
         }
-        
-        // Add function name
-        auto funcName = findChildBySymbol(children, "id");
-        if (funcName) {
-            call->addChild(funcName);
-        }
-        
-        // Add arguments
-        auto argsNode = findChildBySymbol(children, "APARAMS");
-        if (argsNode) {
-            for (const auto& arg : argsNode->getChildren()) {
-                call->addChild(arg);
-            }
+    }
+    auto idNode = findChildBySymbol(children, "id");
+    if (idNode) {
+        node->addChild(idNode);
+    }
+    auto suffix = findChildBySymbol(children, "REPTVARIABLE2");
+    if (suffix) {
+        for (const auto& ch : suffix->getChildren()) {
+            node->addChild(ch);
         }
-        
-        return call;
     }
+    return node;
+}
 
-    // FPARAMS — assemble formal parameter list head and tail.
-    if (nt == "FPARAMS") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("ParamList");
-        }
-        auto paramList = make_shared<ASTNode>("ParamList");
-        auto idNode = findChildBySymbol(children, "id");
-        auto typeNode = findChildBySymbol(children, "TYPE");
-        auto param = make_shared<ASTNode>("Param");
-        if (idNode) param->addChild(idNode);
-        if (typeNode) param->addChild(typeNode);
-        if (auto dims = findChildBySymbol(children, "REPTFPARAMS3")) {
-            for (const auto& dim : dims->getChildren()) {
-                param->addChild(dim);
-            }
+// FUNCTIONCALL — build CallExpr with optional prefix chain and arguments.
+ASTNode::Ptr reduceFUNCTIONCALL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto call = make_shared<ASTNode>("FunctionCall");
+    
+    // Add prefix member access chain if present
+    if (auto prefix = findChildBySymbol(children, "REPTFUNCTIONCALL0")) {
+        for (const auto& nest : prefix->getChildren()) {
+            call->addChild(nest);
         }
-        paramList->addChild(param);
-        if (auto tail = findChildBySymbol(children, "REPTFPARAMS4")) {
-            for (const auto& extra : tail->getChildren()) {
-                paramList->addChild(extra);
-            }
+    }
+    
+    // Add function name
+    auto funcName = findChildBySymbol(children, "id");
+    if (funcName) {
+        call->addChild(funcName);
+    }
+    
+    // Add arguments
+    auto argsNode = findChildBySymbol(children, "APARAMS");
+    if (argsNode) {
+        for (const auto& arg : argsNode->getChildren()) {
+            call->addChild(arg);
         }
-        return paramList;
     }
+    
+    return call;
+}
 
-    // REPTFPARAMS4 — collect additional parameters.
-    if (nt == "REPTFPARAMS4") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("ParamTail");
-        }
-        auto list = make_shared<ASTNode>("ParamTail");
-        if (auto param = findChildBySymbol(children, "FPARAMSTAIL")) {
-            list->addChild(param);
+// FPARAMS — assemble formal parameter list head and tail.
+ASTNode::Ptr reduceFPARAMS(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("ParamList");
+    }
+    auto paramList = make_shared<ASTNode>("ParamList");
+    auto idNode = findChildBySymbol(children, "id");
+    auto typeNode = findChildBySymbol(children, "TYPE");
+    auto param = make_shared<ASTNode>("Param");
+    if (idNode) param->addChild(idNode);
+    if (typeNode) param->addChild(typeNode);
+    if (auto dims = findChildBySymbol(children, "REPTFPARAMS3")) {
+        for (const auto& dim : dims->getChildren()) {
+            param->addChild(dim);
         }
-        if (auto rest = findChildBySymbol(children, "REPTFPARAMS4")) {
-            for (const auto& item : rest->getChildren()) {
-                list->addChild(item);
-            }
+    }
+    paramList->addChild(param);
+    if (auto tail = findChildBySymbol(children, "REPTFPARAMS4")) {
+        for (const auto& extra : tail->getChildren()) {
+            paramList->addChild(extra);
         }
-        return list;
     }
+    return paramList;
+}
 
-    // FPARAMSTAIL — comma parameter continuation.
-    if (nt == "FPARAMSTAIL") {
-        auto param = make_shared<ASTNode>("Param");
-        auto idNode = findChildBySymbol(children, "id");
-        auto typeNode = findChildBySymbol(children, "TYPE");
-        if (idNode) param->addChild(idNode);
-        if (typeNode) param->addChild(typeNode);
-        if (auto dims = findChildBySymbol(children, "REPTFPARAMSTAIL4")) {
-            for (const auto& dim : dims->getChildren()) {
-                param->addChild(dim);
-            }
+// REPTFPARAMS4 — collect additional parameters.
+ASTNode::Ptr reduceREPTFPARAMS4(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("ParamTail");
+    }
+    auto list = make_shared<ASTNode>("ParamTail");
+    if (auto param = findChildBySymbol(children, "FPARAMSTAIL")) {
+        list->addChild(param);
+    }
+    if (auto rest = findChildBySymbol(children, "REPTFPARAMS4")) {
+        for (const auto& item : rest->getChildren()) {
+            list->addChild(item);
         }
-        return param;
     }
+    return list;
+}
 
-    // APARAMS — actual argument list (possibly empty).
-    if (nt == "APARAMS") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("ArgumentList");
-        }
-        auto list = make_shared<ASTNode>("ArgumentList");
-        if (auto firstArg = findChildBySymbol(children, "EXPR")) {
-            list->addChild(firstArg);
-        }
-        if (auto tail = findChildBySymbol(children, "REPTAPARAMS1")) {
-            for (const auto& arg : tail->getChildren()) {
-                if (arg && arg->getType() == "ArgumentExpr" && !arg->getChildren().empty()) {
-                    list->addChild(arg->getChildren().front());
-                } else if (arg) {
-                    list->addChild(arg);
-                }
-            }
+// FPARAMSTAIL — comma parameter continuation.
+ASTNode::Ptr reduceFPARAMSTAIL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto param = make_shared<ASTNode>("Param");
+    auto idNode = findChildBySymbol(children, "id");
+    auto typeNode = findChildBySymbol(children, "TYPE");
+    if (idNode) param->addChild(idNode);
+    if (typeNode) param->addChild(typeNode);
+    if (auto dims = findChildBySymbol(children, "REPTFPARAMSTAIL4")) {
+        for (const auto& dim : dims->getChildren()) {
+            param->addChild(dim);
         }
-        return list;
     }
+    return param;
+}
 
-    // REPTAPARAMS1 — collect additional actual arguments.
-    if (nt == "REPTAPARAMS1") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("ArgumentTail");
-        }
-        auto list = make_shared<ASTNode>("ArgumentTail");
-        if (auto tail = findChildBySymbol(children, "APARAMSTAIL")) {
-            for (const auto& arg : tail->getChildren()) {
-                list->addChild(arg);
-            }
-        }
-        if (auto rest = findChildBySymbol(children, "REPTAPARAMS1")) {
-            for (const auto& arg : rest->getChildren()) {
+// APARAMS — actual argument list (possibly empty).
+ASTNode::Ptr reduceAPARAMS(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("ArgumentList");
+    }
+    auto list = make_shared<ASTNode>("ArgumentList");
+    if (auto firstArg = findChildBySymbol(children, "EXPR")) {
+        list->addChild(firstArg);
+    }
+    if (auto tail = findChildBySymbol(children, "REPTAPARAMS1")) {
+        for (const auto& arg : tail->getChildren()) {
+            if (arg && arg->getType() == "ArgumentExpr" && !arg->getChildren().empty()) {
+                list->addChild(arg->getChildren().front());
+            } else if (arg) {
                 list->addChild(arg);
             }
         }
-        return list;
     }
+    return list;
+}
 
-    // APARAMSTAIL — comma-prefixed argument expression.
-    if (nt == "APARAMSTAIL") {
-        auto node = make_shared<ASTNode>("ArgumentExpr");
-        if (auto expr = findChildBySymbol(children, "EXPR")) {
-            node->addChild(expr);
+// REPTAPARAMS1 — collect additional actual arguments.
+ASTNode::Ptr reduceREPTAPARAMS1(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("ArgumentTail");
+    }
+    auto list = make_shared<ASTNode>("ArgumentTail");
+    if (auto tail = findChildBySymbol(children, "APARAMSTAIL")) {
+        for (const auto& arg : tail->getChildren()) {
+            list->addChild(arg);
         }
-        return node;
     }
-
-    // ARRAYSIZE ::= [ intlit ] | [ ] — dimension specification for arrays.
-    if (nt == "ARRAYSIZE") {
-        auto dim = make_shared<ASTNode>("ArrayDim");
-        if (auto intNode = findChildBySymbol(children, "intlit")) {
-            dim->addChild(intNode);
+    if (auto rest = findChildBySymbol(children, "REPTAPARAMS1")) {
+        for (const auto& arg : rest->getChildren()) {
+            list->addChild(arg);
         }
-        return dim;
     }
+    return list;
+}
+
+// APARAMSTAIL — comma-prefixed argument expression.
+ASTNode::Ptr reduceAPARAMSTAIL(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto node = make_shared<ASTNode>("ArgumentExpr");
+    if (auto expr = findChildBySymbol(children, "EXPR")) {
+        node->addChild(expr);
+    }
+    return node;
+}
 
-    // MEMBERFUNCDECL — member function declaration in class.
-    if (nt == "MEMBERFUNCDECL") {
-        auto decl = make_shared<ASTNode>("MemberFuncDecl");
-        if (!rhs.empty() && rhs.front() == "constructor") {
-            auto ctor = make_shared<ASTNode>("Constructor");
-            auto params = findChildBySymbol(children, "FPARAMS");
-            if (params) {
-                for (const auto& param : params->getChildren()) {
-                    ctor->addChild(param);
-                }
-            }
-            return ctor;
-        }
-        auto nameNode = findChildBySymbol(children, "id");
+// ARRAYSIZE ::= [ intlit ] | [ ] — dimension specification for arrays.
+ASTNode::Ptr reduceARRAYSIZE(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto dim = make_shared<ASTNode>("ArrayDim");
+    if (auto intNode = findChildBySymbol(children, "intlit")) {
+        dim->addChild(intNode);
+    }
+    return dim;
+}
+
+// MEMBERFUNCDECL — member function declaration in class.
+ASTNode::Ptr reduceMEMBERFUNCDECL(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    auto decl = make_shared<ASTNode>("MemberFuncDecl");
+    if (!rhs.empty() && rhs.front() == "constructor") {
+        auto ctor = make_shared<ASTNode>("Constructor");
         auto params = findChildBySymbol(children, "FPARAMS");
-        auto returnType = findChildBySymbol(children, "RETURNTYPE");
-        if (nameNode) decl->addChild(nameNode);
         if (params) {
             for (const auto& param : params->getChildren()) {
-                decl->addChild(param);
+                ctor->addChild(param);
             }
         }
-        if (returnType) decl->addChild(returnType);
-        return decl;
+        return ctor;
     }
-
-    // INDICE ::= [ ARITHEXPR ] — array index expression.
-    if (nt == "INDICE") {
-        auto idx = make_shared<ASTNode>("Index");
-        if (auto expr = findChildBySymbol(children, "ARITHEXPR")) {
-            idx->addChild(expr);
+    auto nameNode = findChildBySymbol(children, "id");
+    auto params = findChildBySymbol(children, "FPARAMS");
+    auto returnType = findChildBySymbol(children, "RETURNTYPE");
+    if (nameNode) decl->addChild(nameNode);
+    if (params) {
+        for (const auto& param : params->getChildren()) {
+            decl->addChild(param);
         }
-        return idx;
     }
+    if (returnType) decl->addChild(returnType);
+    return decl;
+}
+
+// INDICE ::= [ ARITHEXPR ] — array index expression.
+ASTNode::Ptr reduceINDICE(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto idx = make_shared<ASTNode>("Index");
+    if (auto expr = findChildBySymbol(children, "ARITHEXPR")) {
+        idx->addChild(expr);
+    }
+    return idx;
+}
 
-    // IDNEST ::= id REPTIDNEST1 . | id ( APARAMS ) . — member access chain link.
-    if (nt == "IDNEST") {
-        auto nest = make_shared<ASTNode>("MemberAccess");
-        if (auto idNode = findChildBySymbol(children, "id")) {
-            nest->addChild(idNode);
+// IDNEST ::= id REPTIDNEST1 . | id ( APARAMS ) . — member access chain link.
+ASTNode::Ptr reduceIDNEST(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    auto nest = make_shared<ASTNode>("MemberAccess");
+    if (auto idNode = findChildBySymbol(children, "id")) {
+        nest->addChild(idNode);
+    }
+    if (auto indices = findChildBySymbol(children, "REPTIDNEST1")) {
+        for (const auto& idx : indices->getChildren()) {
+            nest->addChild(idx);
         }
-        if (auto indices = findChildBySymbol(children, "REPTIDNEST1")) {
-            for (const auto& idx : indices->getChildren()) {
-                nest->addChild(idx);
-            }
-        }
-        if (auto params = findChildBySymbol(children, "APARAMS")) {
-            auto call = make_shared<ASTNode>("MethodCall");
-            for (const auto& arg : params->getChildren()) {
-                call->addChild(arg);
-            }
-            nest->addChild(call);
-        }
-        return nest;
     }
-
-    // REPTMEMBERVARDECL4, REPTLOCALVARDECL4, REPTFPARAMS3, REPTFPARAMSTAIL4 — array dimension lists.
-    if (nt == "REPTMEMBERVARDECL4" || nt == "REPTLOCALVARDECL4" || 
-        nt == "REPTFPARAMS3" || nt == "REPTFPARAMSTAIL4") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("DimList");
-        }
-        auto list = make_shared<ASTNode>("DimList");
-        if (auto dim = findChildBySymbol(children, "ARRAYSIZE")) {
-            list->addChild(dim);
+    if (auto params = findChildBySymbol(children, "APARAMS")) {
+        auto call = make_shared<ASTNode>("MethodCall");
+        for (const auto& arg : params->getChildren()) {
+            call->addChild(arg);
         }
-        if (auto rest = findChildBySymbol(children, nt)) {
-            for (const auto& d : rest->getChildren()) {
-                list->addChild(d);
-            }
-        }
-        return list;
+        nest->addChild(call);
     }
+    return nest;
+}
 
-    // REPTIDNEST1 ::= INDICE REPTIDNEST1 | EPSILON — indices on nested member.
-    if (nt == "REPTIDNEST1") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("IndiceList");
-        }
-        auto list = make_shared<ASTNode>("IndiceList");
-        if (auto idx = findChildBySymbol(children, "INDICE")) {
-            list->addChild(idx);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTIDNEST1")) {
-            for (const auto& i : rest->getChildren()) {
-                list->addChild(i);
-            }
-        }
-        return list;
+// REPTMEMBERVARDECL4, REPTLOCALVARDECL4, REPTFPARAMS3, REPTFPARAMSTAIL4 — array dimension lists.
+ASTNode::Ptr reduceDimList(string_view nt, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("DimList");
     }
-
-    // REPTVARIABLE0 ::= IDNEST REPTVARIABLE0 | EPSILON — prefix member access chain.
-    if (nt == "REPTVARIABLE0") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("PrefixChain");
-        }
-        auto list = make_shared<ASTNode>("PrefixChain");
-        if (auto nest = findChildBySymbol(children, "IDNEST")) {
-            list->addChild(nest);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTVARIABLE0")) {
-            for (const auto& ch : rest->getChildren()) {
-                list->addChild(ch);
-            }
-        }
-        return list;
+    auto list = make_shared<ASTNode>("DimList");
+    if (auto dim = findChildBySymbol(children, "ARRAYSIZE")) {
+        list->addChild(dim);
     }
-
-    // REPTVARIABLE2 ::= INDICE REPTVARIABLE2 | EPSILON — suffix indices on variable.
-    if (nt == "REPTVARIABLE2") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("SuffixIndices");
-        }
-        auto list = make_shared<ASTNode>("SuffixIndices");
-        if (auto idx = findChildBySymbol(children, "INDICE")) {
-            list->addChild(idx);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTVARIABLE2")) {
-            for (const auto& i : rest->getChildren()) {
-                list->addChild(i);
-            }
+    if (auto rest = findChildBySymbol(children, nt)) {
+        for (const auto& d : rest->getChildren()) {
+            list->addChild(d);
         }
-        return list;
     }
+    return list;
+}
 
-    // REPTFUNCTIONCALL0 ::= IDNEST REPTFUNCTIONCALL0 | EPSILON — prefix member access for calls.
-    if (nt == "REPTFUNCTIONCALL0") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>("CallPrefix");
-        }
-        auto list = make_shared<ASTNode>("CallPrefix");
-        if (auto nest = findChildBySymbol(children, "IDNEST")) {
-            list->addChild(nest);
-        }
-        if (auto rest = findChildBySymbol(children, "REPTFUNCTIONCALL0")) {
-            for (const auto& ch : rest->getChildren()) {
-                list->addChild(ch);
-            }
-        }
-        return list;
+// REPTIDNEST1 ::= INDICE REPTIDNEST1 | EPSILON — indices on nested member.
+ASTNode::Ptr reduceREPTIDNEST1(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("IndiceList");
     }
-
-    // OPTFUNCHEAD1 ::= id sr | EPSILON — optional class scope qualifier.
-    if (nt == "OPTFUNCHEAD1") {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return nullptr;
-        }
-        if (auto idNode = findChildBySymbol(children, "id")) {
-            auto scope = make_shared<ASTNode>("ScopeResolution");
-            scope->addChild(idNode);
-            return scope;
-        }
-        return nullptr;
+    auto list = make_shared<ASTNode>("IndiceList");
+    if (auto idx = findChildBySymbol(children, "INDICE")) {
+        list->addChild(idx);
     }
-
-    // Generic REPT* fallback — build homogeneous list node.
-    if (nt.rfind("REPT", 0) == 0) {
-        if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
-            return make_shared<ASTNode>(nt);
+    if (auto rest = findChildBySymbol(children, "REPTIDNEST1")) {
+        for (const auto& i : rest->getChildren()) {
+            list->addChild(i);
         }
-        return makeListNode(nt, children, rhs);
     }
+    return list;
+}
 
-    // Generic OPT* fallback — return optional child or null.
-    if (nt.rfind("OPT", 0) == 0) {
-        if (children.empty()) {
-            return nullptr;
+// REPTVARIABLE0 ::= IDNEST REPTVARIABLE0 | EPSILON — prefix member access chain.
+ASTNode::Ptr reduceREPTVARIABLE0(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("PrefixChain");
+    }
+    auto list = make_shared<ASTNode>("PrefixChain");
+    if (auto nest = findChildBySymbol(children, "IDNEST")) {
+        list->addChild(nest);
+    }
+    if (auto rest = findChildBySymbol(children, "REPTVARIABLE0")) {
+        for (const auto& ch : rest->getChildren()) {
+            list->addChild(ch);
         }
-        return childAt(children, 0);
     }
-
-    cerr << "[ERROR] Unknown nonterminal " << nt << "\n";
-    return makePlaceholder(nt, children);
-}
-
-}  // namespace
-
-static vector<string> splitWS(const string& s) {
-    vector<string> out;
-    string cur; istringstream is(s);
-    while (is >> cur) out.push_back(cur);
-    return out;
+    return list;
 }
 
-static string trimAscii(const string& s) {
-    size_t start = 0;
-    while (start < s.size() && isspace(static_cast<unsigned char>(s[start]))) {
-        ++start;
+// REPTVARIABLE2 ::= INDICE REPTVARIABLE2 | EPSILON — suffix indices on variable.
+ASTNode::Ptr reduceREPTVARIABLE2(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("SuffixIndices");
+    }
+    auto list = make_shared<ASTNode>("SuffixIndices");
+    if (auto idx = findChildBySymbol(children, "INDICE")) {
+        list->addChild(idx);
     }
-    size_t end = s.size();
-    while (end > start && isspace(static_cast<unsigned char>(s[end - 1]))) {
-        --end;
+    if (auto rest = findChildBySymbol(children, "REPTVARIABLE2")) {
+        for (const auto& i : rest->getChildren()) {
+            list->addChild(i);
+        }
     }
-    return s.substr(start, end - start);
+    return list;
 }
 
-static string sanitizeTableCell(string val) {
-    const string arrow = u8"→";
-    const string nbsp = "\xC2\xA0";
-
-    size_t pos = 0;
-    while ((pos = val.find(nbsp, pos)) != string::npos) {
-        val.replace(pos, nbsp.size(), " ");
+// REPTFUNCTIONCALL0 ::= IDNEST REPTFUNCTIONCALL0 | EPSILON — prefix member access for calls.
+ASTNode::Ptr reduceREPTFUNCTIONCALL0(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>("CallPrefix");
+    }
+    auto list = make_shared<ASTNode>("CallPrefix");
+    if (auto nest = findChildBySymbol(children, "IDNEST")) {
+        list->addChild(nest);
     }
-    for (char& ch : val) {
-        if (ch == '\r' || ch == '\t') {
-            ch = ' ';
+    if (auto rest = findChildBySymbol(children, "REPTFUNCTIONCALL0")) {
+        for (const auto& ch : rest->getChildren()) {
+            list->addChild(ch);
         }
     }
+    return list;
+}
 
-    size_t arrowPos = val.find(arrow);
-    if (arrowPos != string::npos) {
-        val = val.substr(arrowPos + arrow.size());
+// OPTFUNCHEAD1 ::= id sr | EPSILON — optional class scope qualifier.
+ASTNode::Ptr reduceOPTFUNCHEAD1(string_view, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return nullptr;
+    }
+    if (auto idNode = findChildBySymbol(children, "id")) {
+        auto scope = make_shared<ASTNode>("ScopeResolution");
+        scope->addChild(idNode);
+        return scope;
     }
+    return nullptr;
+}
 
-    val = trimAscii(val);
-    return val;
+// Generic REPT* fallback — build homogeneous list node.
+ASTNode::Ptr reduceGenericREPT(string_view nt, const RhsNames& rhs, const vector<ChildValue>& children) {
+    if (rhs.size() == 1 && isEpsilonSymbol(rhs.front())) {
+        return make_shared<ASTNode>(string(nt));
+    }
+    return makeListNode(nt, children, rhs);
 }
 
-static vector<string> splitCsvLine(const string& line) {
-    vector<string> cells;
-    string cell;
-    stringstream ss(line);
-    while (getline(ss, cell, ',')) {
-        if (!cell.empty() && cell.front() == '"' && cell.back() != '"') {
-            string tail;
-            bool closed = false;
-            while (getline(ss, tail, ',')) {
-                cell += ',' + tail;
-                if (!tail.empty() && tail.back() == '"') {
-                    closed = true;
-                    break;
-                }
-            }
-            if (!closed) {
-                throw runtime_error("Malformed CSV line: " + line);
-            }
-        }
-        cells.push_back(cell);
+// Generic OPT* fallback — return optional child or null.
+ASTNode::Ptr reduceGenericOPT(string_view, const RhsNames&, const vector<ChildValue>& children) {
+    if (children.empty()) {
+        return nullptr;
     }
-    return cells;
+    return childAt(children, 0);
 }
 
-static Table loadTable(const string& path) {
-    Table T;
-    ifstream in(path);
-    if (!in) { throw runtime_error("Cannot open parsing_table.csv"); }
-    string line;
+// Semantic actions by nonterminal name.
+const pair<const char*, SemanticAction> kSemanticActions[] = {
+    {"START", reduceSTART},
+    {"REPTSTART0", reduceREPTSTART0},
+    {"CLASSDECLORFUNCDEF", reduceCLASSDECLORFUNCDEF},
+    {"REPTCLASSDECL4", reduceREPTCLASSDECL4},
+    {"VISIBILITY", reduceVISIBILITY},
+    {"MEMBERDECL", reduceMEMBERDECL},
+    {"MEMBERVARDECL", reduceMEMBERVARDECL},
+    {"CLASSDECL", reduceCLASSDECL},
+    {"OPTCLASSDECL2", reduceOPTCLASSDECL2},
+    {"REPTOPTCLASSDECL22", reduceREPTOPTCLASSDECL22},
+    {"ASSIGNSTAT", reduceASSIGNSTAT},
+    {"STATEMENT", reduceSTATEMENT},
+    {"STATBLOCK", reduceSTATBLOCK},
+    {"FUNCBODY", reduceFUNCBODY},
+    {"FUNCDEF", reduceFUNCDEF},
+    {"FUNCHEAD", reduceFUNCHEAD},
+    {"RETURNTYPE", reducePassThrough},
+    {"TYPE", reducePassThrough},
+    {"ASSIGNOP", reducePassThrough},
+    {"ADDOP", reducePassThrough},
+    {"MULTOP", reducePassThrough},
+    {"SIGN", reducePassThrough},
+    {"RELOP", reducePassThrough},
+    {"EXPR", reduceEXPR},
+    {"RELEXPR", reduceRELEXPR},
+    {"ARITHEXPR", reduceARITHEXPR},
+    {"TERM", reduceTERM},
+    {"RIGHTRECARITHEXPR", reduceRIGHTREC},
+    {"RIGHTRECTERM", reduceRIGHTREC},
+    {"FACTEXPR", reduceFACTEXPR},
+    {"FACTOR", reduceFACTOR},
+    {"REPTFUNCBODY1", reduceREPTFUNCBODY1},
+    {"REPTSTATBLOCK1", reduceREPTSTATBLOCK1},
+    {"LOCALVARDECLORSTMT", reduceLOCALVARDECLORSTMT},
+    {"LOCALVARDECL", reduceLOCALVARDECL},
+    {"VARIABLE", reduceVARIABLE},
+    {"FUNCTIONCALL", reduceFUNCTIONCALL},
+    {"FPARAMS", reduceFPARAMS},
+    {"REPTFPARAMS4", reduceREPTFPARAMS4},
+    {"FPARAMSTAIL", reduceFPARAMSTAIL},
+    {"APARAMS", reduceAPARAMS},
+    {"REPTAPARAMS1", reduceREPTAPARAMS1},
+    {"APARAMSTAIL", reduceAPARAMSTAIL},
+    {"ARRAYSIZE", reduceARRAYSIZE},
+    {"MEMBERFUNCDECL", reduceMEMBERFUNCDECL},
+    {"INDICE", reduceINDICE},
+    {"IDNEST", reduceIDNEST},
+    {"REPTMEMBERVARDECL4", reduceDimList},
+    {"REPTLOCALVARDECL4", reduceDimList},
+    {"REPTFPARAMS3", reduceDimList},
+    {"REPTFPARAMSTAIL4", reduceDimList},
+    {"REPTIDNEST1", reduceREPTIDNEST1},
+    {"REPTVARIABLE0", reduceREPTVARIABLE0},
+    {"REPTVARIABLE2", reduceREPTVARIABLE2},
+    {"REPTFUNCTIONCALL0", reduceREPTFUNCTIONCALL0},
+    {"OPTFUNCHEAD1", reduceOPTFUNCHEAD1},
+};
 
-    if (!getline(in, line)) throw runtime_error("Empty parsing_table.csv");
-    vector<string> headerCells = splitCsvLine(line);
-    if (!headerCells.empty() && !headerCells.front().empty()) {
-        headerCells.insert(headerCells.begin(), "");
-    }
-    for (size_t j = 1; j < headerCells.size(); ++j) {
-        string term = sanitizeTableCell(headerCells[j]);
-        T.terms.push_back(term);
-    }
-    while (!T.terms.empty() && T.terms.back().empty()) {
-        T.terms.pop_back();
+// The semantic action of every nonterminal of a table, resolved once when
+// the table is loaded so that a reduction is one indirect call. A
+// nonterminal with no registered action uses the generic REPT* or OPT*
+// one by its prefix; any other is reported here and builds placeholders.
+class SemanticActions {
+public:
+    explicit SemanticActions(const Table& PT);
+
+    ASTNode::Ptr reduce(const Table& PT, const ActionFrame& frame, const vector<ChildValue>& children) const {
+        const SemanticAction action = actions[static_cast<size_t>(frame.nonterminal - PT.termCount)];
+        return action(PT.symbols[static_cast<size_t>(frame.nonterminal)], PT.rhs(frame.production), children);
     }
 
-    const size_t expectedColumns = T.terms.size() + 1; // include nonterminal column
+private:
+    vector<SemanticAction> actions;   // by nonterminal ID - termCount
+};
 
-    while (getline(in, line)) {
-        if (line.empty()) {
-            continue;
-        }
-        vector<string> cells = splitCsvLine(line);
-        if (cells.empty()) {
-            continue;
+SemanticActions::SemanticActions(const Table& PT) {
+    for (int X = PT.termCount; X < PT.termCount + PT.nontermCount; ++X) {
+        const string_view name = PT.symbols[static_cast<size_t>(X)];
+        SemanticAction action = nullptr;
+        for (const auto& [registered, fn] : kSemanticActions) {
+            if (name == registered) {
+                action = fn;
+                break;
+            }
         }
-        if (cells.size() < expectedColumns) {
-            cells.resize(expectedColumns);
+        if (!action && name.rfind("REPT", 0) == 0) {
+            action = reduceGenericREPT;
+        } else if (!action && name.rfind("OPT", 0) == 0) {
+            action = reduceGenericOPT;
+        } else if (!action) {
+            logWarn("No semantic action for nonterminal " + string(name) + "; its AST nodes will be placeholders.");
+            action = reducePlaceholder;
         }
+        actions.push_back(action);
+    }
+}
 
-        string A = sanitizeTableCell(cells[0]);
-        if (A.empty()) {
-            continue;
-        }
-        T.nonterms.push_back(A); // Store nonterminal
+}  // namespace
 
-        vector<vector<string>> row(T.terms.size());
-        for (size_t j = 1; j < cells.size() && (j - 1) < T.terms.size(); ++j) {
-            string val = sanitizeTableCell(cells[j]);
-            if (val == "#" || val.empty()) {
-                row[j - 1] = {};
-            } else if (val == "EPSILON" || val == "&epsilon") {
-                row[j - 1] = {"EPSILON"};
-            } else {
-                row[j - 1] = splitWS(val);
-            }
-        }
-        if (A == "START") {
-            cerr << "[DEBUG] START row entries:\n";
-            for (size_t idx = 0; idx < row.size(); ++idx) {
-                if (!row[idx].empty()) {
-                    cerr << "  term " << T.terms[idx] << " -> ";
-                    for (const auto& sym : row[idx]) {
-                        cerr << sym << ' ';
-                    }
-                    cerr << "\n";
-                }
-            }
+// --emit=<list>: the per-file outputs to write. Work that only feeds a
+// disabled output is skipped (with neither ast nor dot, no AST is built).
+constexpr unsigned kEmitAst = 1u << 0;          // .outast
+constexpr unsigned kEmitDot = 1u << 1;          // .dot
+constexpr unsigned kEmitTokens = 1u << 2;       // .outtokens
+constexpr unsigned kEmitDerivation = 1u << 3;   // .outderivlog (+ .outderivation)
+constexpr unsigned kEmitErrors = 1u << 4;       // .outsyntaxerrors
+constexpr unsigned kEmitAll = kEmitAst | kEmitDot | kEmitTokens | kEmitDerivation | kEmitErrors;
+
+// Parses "ast,dot,..." into kEmit* bits; false on an unknown name. An empty
+// list selects nothing (pass/fail only).
+static bool parseEmitList(const string& list, unsigned& emit) {
+    static const pair<const char*, unsigned> kNames[] = {
+        {"ast", kEmitAst}, {"dot", kEmitDot}, {"tokens", kEmitTokens},
+        {"derivation", kEmitDerivation}, {"errors", kEmitErrors},
+    };
+    emit = 0;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t comma = list.find(',', pos);
+        if (comma == string::npos) comma = list.size();
+        const string name = list.substr(pos, comma - pos);
+        bool known = false;
+        for (const auto& [n, bit] : kNames) {
+            if (name == n) {
+                emit |= bit;
+                known = true;
+            }
+        }
+        if (!known) {
+            return false;
         }
-        row.resize(T.terms.size());
-        T.map.push_back(std::move(row));
+        pos = comma + 1;
     }
-    return T;
+    return true;
 }
 
+// --engine: the table-driven loop, the generated recursive-descent parser,
+// or both in turn with their .outast compared (diff).
+enum class Engine { Table, RecursiveDescent, Differential };
+
+// Command-line switches that change how each file is processed.
+struct DriverOptions {
+    bool stats = false;        // --stats: per-file timing report
+    size_t streamWindow = 0;   // --stream[=bytes]: lexer window size, 0 = batch mode
+    unsigned lexThreads = 1;   // --lex-threads=N: parallel lexing in batch mode
+    string compileTablePath;   // --compile-table=<out>: write the binary table and exit
+    bool expandDerivation = false;   // --expand-derivation: also write the readable .outderivation
+    unsigned emit = kEmitAll;        // --emit=<list>
+    bool check = false;              // --check: lexer and predictor only, diagnostics to stdout
+    Engine engine = Engine::Table;   // --engine=table|rd|diff
+};
+
+constexpr size_t kDefaultStreamWindow = size_t(1) << 20;
+
+// --engine=rd recurses once per nonterminal it is inside of, at about 100
+// bytes of stack a level. A file nested deeper than this is handed to the
+// table engine instead.
+constexpr int kMaxRdDepth = 4096;
+
+// Per-file measurements reported by --stats (milliseconds).
+struct ParseStats {
+    size_t sourceBytes = 0;
+    size_t tokenCount = 0;
+    bool sourceMapped = false;
+    bool streamed = false;
+    double loadMs = 0;
+    double lexMs = 0;
+    double parseMs = 0;
+    double writeMs = 0;
+};
+
 struct ParseOutcome {
     bool hadErrors = false;
     filesystem::path sourcePath;
-    filesystem::path derivationPath;
+    filesystem::path derivationLogPath;
+    filesystem::path derivationPath;   // only with --expand-derivation
     filesystem::path errorPath;
     filesystem::path astTextPath;
     filesystem::path astDotPath;
     filesystem::path tokensPath;
+    bool rdTooDeep = false;   // --engine=rd passed kMaxRdDepth and stopped; its outputs are incomplete
+    ParseStats stats;
 };
 
+using StatsClock = chrono::steady_clock;
+
+static double elapsedMs(StatsClock::time_point since) {
+    return chrono::duration<double, milli>(StatsClock::now() - since).count();
+}
+
 static bool hasWildcard(const string& spec) {
     return spec.find('*') != string::npos || spec.find('?') != string::npos;
 }
@@ -1280,6 +1258,11 @@ static bool matchPattern(const string& pattern, const string& value) {
     return p == pattern.size();
 }
 
+static bool isTableFile(const string& arg) {
+    const string ext = filesystem::path(arg).extension().string();
+    return ext == ".csv" || ext == ".tbl" || ext == ".grm";
+}
+
 static bool isSourceFile(const filesystem::path& p) {
     const string ext = p.extension().string();
     return ext == ".src" || ext == ".source";
@@ -1327,70 +1310,341 @@ static vector<filesystem::path> expandInputSpec(const string& spec) {
         }
     } else if (fs::is_regular_file(status)) {
         addIfSource(pathSpec);
+    } else if (fs::is_fifo(status) || fs::is_character_file(status)) {
+        // Named explicitly (e.g. /dev/stdin or a FIFO): read through the
+        // SourceBuffer fallback path rather than mapped.
+        results.push_back(pathSpec);
     }
     return results;
 }
 
-static int termIndex(const Table& T, const string& a) {
-    for (int j=0;j<(int)T.terms.size();++j) if (T.terms[j]==a) return j;
-    return -1;
-}
-static int nontermIndex(const Table& T, const string& A) {
-    for (int i=0;i<(int)T.nonterms.size();++i) if (T.nonterms[i]==A) return i;
-    return -1;
+// True when the parse stack's top is the action marker of a
+// REPTSTART0 -> CLASSDECLORFUNCDEF REPTSTART0 frame whose item has already
+// been streamed out (its value is the null placeholder on the semantic stack).
+static bool continuesTopLevelList(const Table& PT,
+                                  const vector<StackEntry>& stack,
+                                  const vector<ActionFrame>& actionFrames,
+                                  const SemanticStack& semStack) {
+    if (stack.empty() || stack.back().tag() != StackTag::Action || semStack.empty() || semStack.peek()) {
+        return false;
+    }
+    const int idx = stack.back().payload();
+    if (idx < 0 || idx >= static_cast<int>(actionFrames.size())) {
+        return false;
+    }
+    const ActionFrame& frame = actionFrames[idx];
+    const RhsNames rhs = PT.rhs(frame.production);
+    return PT.symbols[static_cast<size_t>(frame.nonterminal)] == "REPTSTART0" && rhs.size() == 2 &&
+           rhs[0] == "CLASSDECLORFUNCDEF";
 }
 
-// ---------- Derivation pretty-printer ----------
-static string join(const vector<string>& v, const string& sep=" ") {
-    string out;
-    for (size_t i=0;i<v.size();++i) {
-        if (i) out += sep;
-        out += v[i];
+// ---------- Parser input ----------
+// The significant tokens of one file, ending with "$", indexed from 0.
+// Batch mode lexes the whole file up front. With --stream tokens are lexed
+// on demand into a ring holding only the parser's position up to its
+// furthest lookahead, and the lexer refills from a fixed-size window;
+// tokens the parser has consumed are released.
+//
+// Each lsqbr and lpar entry also records the index of its closing bracket
+// as soon as that is queued, matching square brackets and parentheses
+// separately (a "[" is closed by the first "]" that brings the count of
+// unclosed "[" back down, whatever parentheses lie between), so the
+// lookahead heuristics step over a bracketed region in one jump.
+class TokenStream {
+public:
+    static constexpr size_t kUnclosed = static_cast<size_t>(-1);
+    struct Entry {
+        int term;     // a table column
+        Token tok;
+        size_t close = kUnclosed;   // lsqbr / lpar only: index of the matching bracket
+    };
+    using TokenSink = function<void(const Token&)>;   // every token
+    // kTermLexErr / kTermUnknown, with the token's position and text.
+    using DropSink = function<void(const Token&, int term, SourcePos pos, string_view text)>;
+
+    // With a window, `commentText` says whether onToken needs the text of
+    // comments; without it a comment longer than the window is skipped
+    // across refills instead of growing the window to hold it.
+    TokenStream(const Table& table, Lexer& lexer, LineIndex& lines, io::SourceWindow* window, bool commentText,
+                TokenSink onToken, DropSink onDrop)
+        : PT(table), lx(lexer), lines(lines), window(window), commentText(commentText),
+          onToken(std::move(onToken)), onDrop(std::move(onDrop)), ring(kInitialRing), mask(kInitialRing - 1) {}
+
+    // Whether token `idx` exists, lexing up to it if needed.
+    bool has(size_t idx) {
+        while (end <= idx && !ended) {
+            lexNext();
+        }
+        return idx < end;
+    }
+    // Batch mode, before anything was lexed: lexes the whole file, split
+    // across `threads` threads if > 1.
+    void lexAll(unsigned threads = 1) {
+        if (threads > 1 && window == nullptr) {
+            for (const Token& t : lexParallel(lx.src, threads)) {
+                accept(t);
+            }
+            lx.i = lx.src.size();
+            return;
+        }
+        while (!ended) lexNext();
+    }
+    // Streaming: lexes what the parser left unread (after an early stop) so
+    // every token still reaches the sinks, without keeping any of it.
+    void drain() {
+        while (!ended) {
+            first = end;
+            lexNext();
+        }
     }
-    return out;
-}
 
-// Replace leftmost nonterminal in α A β with α γ β
-static bool looksLikeNonterminal(const string& sym) {
-    if (sym.empty()) {
-        return false;
+    const Entry& operator[](size_t idx) const { return ring[idx & mask]; }
+    string_view lexeme(const Token& t) const { return lx.lexeme(t); }
+
+    // `open` is an lsqbr or lpar entry: the index just past its matching
+    // bracket, or past the last token if it is never closed. Lexes ahead
+    // only as far as that bracket.
+    size_t skipBracketed(size_t open) {
+        while ((*this)[open].close == kUnclosed && !ended) {
+            lexNext();
+        }
+        const size_t close = (*this)[open].close;
+        return close == kUnclosed ? end : close + 1;
+    }
+
+    // Streaming only: the parser will not look at tokens before `idx` again.
+    void releaseBefore(size_t idx) {
+        if (window != nullptr && idx > first) {
+            first = min(idx, end);
+        }
+    }
+
+private:
+    static constexpr size_t kInitialRing = 64;
+    // Bytes the lexer may inspect past the end of a token; a token ending
+    // this close to the window edge is re-lexed after a refill.
+    static constexpr size_t kLexSlack = 4;
+
+    void lexNext() {
+        while (!accept(nextRaw())) {
+        }
     }
-    if (sym.front() == '<' && sym.back() == '>') {
+
+    // Reports `t` and queues it if the parser sees it; true once an entry
+    // was added.
+    bool accept(const Token& t) {
+        onToken(t);
+        const int a = PT.terminalOf(t);
+        if (a == kTermSkip) {
+            return false;
+        }
+        if (a == kTermLexErr) {
+            drop(t, a);
+            return false;
+        }
+        if (t.kind == TokenKind::Eof) {
+            push({PT.ids.eof, t});
+            ended = true;
+            return true;
+        }
+        if (a == kTermUnknown) {
+            drop(t, a);
+            return false;
+        }
+        push({a, t});
         return true;
     }
-    return static_cast<bool>(isupper(static_cast<unsigned char>(sym.front())));
-}
 
-static void applyLeftmost(vector<string>& sentential, const vector<string>& rhs) {
-    for (size_t i=0;i<sentential.size();++i) {
-        const string& sym = sentential[i];
-        if (looksLikeNonterminal(sym)) {
-            vector<string> newSentential;
-            newSentential.insert(newSentential.end(), sentential.begin(), sentential.begin()+i);
-            if (!(rhs.size()==1 && rhs[0]=="EPSILON")) {
-                newSentential.insert(newSentential.end(), rhs.begin(), rhs.end());
-            }
-            newSentential.insert(newSentential.end(), sentential.begin()+i+1, sentential.end());
-            sentential.swap(newSentential);
+    void drop(const Token& t, int term) {
+        if (skipped) {
+            onDrop(t, term, skippedAt, skippedText);
             return;
         }
-    }
-}
+        lines.extend(lx.src);
+        onDrop(t, term, lines.at(t.offset), lx.lexeme(t));
+    }
+
+    Token nextRaw() {
+        if (window == nullptr) {
+            return lx.nextToken();
+        }
+        skipped = false;
+        while (true) {
+            const Lexer before = lx;
+            const Token t = lx.nextToken();
+            if (window->atEof() || t.offset + t.length + kLexSlack < lx.src.size()) {
+                return t;
+            }
+            // The token may continue past the window: keep the live ring
+            // entries and the partial token, read more, and lex it again.
+            // Whitespace before it is dropped, however long the run.
+            lx = before;
+            lx.skipWhitespace();
+            if (!commentText && (lx.match('/', '/') || lx.match('/', '*'))) {
+                return skipComment();
+            }
+            refill(lx.i);
+        }
+    }
+
+    // Drops the window before `keep` (or the oldest live entry, if that is
+    // earlier) and reads more behind it.
+    void refill(size_t keep) {
+        if (first < end) {
+            keep = min<size_t>(keep, (*this)[first].tok.offset);
+        }
+        lines.extend(lx.src);
+        const size_t shift = window->refill(keep);
+        lines.slide(shift);
+        lx.src = window->view();
+        lx.i -= shift;
+        for (size_t k = first; k < end; ++k) {
+            ring[k & mask].tok.offset -= static_cast<uint32_t>(shift);
+        }
+    }
+
+    // The comment at lx.i, scanned through as many windows as it spans
+    // with only the unscanned bytes kept. Its text is gone by the end, so
+    // the token is empty, at the comment's end; if it is reported,
+    // skippedAt and skippedText stand for its start and text.
+    Token skipComment() {
+        const bool block = lx.match('/', '*');
+        lines.extend(lx.src);
+        skippedAt = lines.at(lx.i);
+        skippedText = block ? "/*..." : "//...";
+        skipped = true;
+        size_t p = lx.i + 2;
+        int depth = 1;
+        while (true) {
+            p = block ? lx.scanBlockComment(p, depth) : lx.scanLineComment(p);
+            if (block ? depth == 0 : p < lx.src.size()) {
+                break;
+            }
+            if (window->atEof()) {
+                p = lx.src.size();
+                break;
+            }
+            lx.i = p;
+            refill(p);
+            p = lx.i;
+        }
+        lx.i = p;
+        return lx.make(!block ? TokenKind::InlineCmt : depth == 0 ? TokenKind::BlockCmt : TokenKind::InvalidComment, p);
+    }
+
+    void push(const Entry& e) {
+        if (end - first == ring.size()) {
+            // Lookahead outgrew the ring (a long bracketed index or argument
+            // list); double it, keeping each entry at index & mask.
+            vector<Entry> bigger(ring.size() * 2);
+            const size_t biggerMask = bigger.size() - 1;
+            for (size_t k = first; k < end; ++k) {
+                bigger[k & biggerMask] = ring[k & mask];
+            }
+            ring.swap(bigger);
+            mask = biggerMask;
+        }
+        ring[end & mask] = e;
+        matchBrackets(e.term);
+        ++end;
+    }
+
+    // Called with the entry at `end` just queued.
+    void matchBrackets(int term) {
+        if (term == PT.ids.lsqbr) {
+            openSquare.push_back(end);
+        } else if (term == PT.ids.lpar) {
+            openParen.push_back(end);
+        } else if (term == PT.ids.rsqbr || term == PT.ids.rpar) {
+            vector<size_t>& open = (term == PT.ids.rsqbr) ? openSquare : openParen;
+            if (!open.empty()) {
+                // A released opener is never asked about again.
+                if (open.back() >= first) {
+                    ring[open.back() & mask].close = end;
+                }
+                open.pop_back();
+            }
+        }
+    }
+
+    const Table& PT;
+    Lexer& lx;
+    LineIndex& lines;
+    io::SourceWindow* window;
+    bool commentText;
+    TokenSink onToken;
+    DropSink onDrop;
+    vector<Entry> ring;
+    size_t mask;
+    size_t first = 0;   // oldest live entry
+    size_t end = 0;     // one past the newest entry
+    bool ended = false;
+    vector<size_t> openSquare, openParen;   // indices of still-unclosed lsqbr / lpar
+    bool skipped = false;   // the token nextRaw returned came from skipComment
+    SourcePos skippedAt;
+    string_view skippedText;
+};
 
 // ---------- Parser driver ----------
+// The driver's steps as the generated parser calls them
+// (rd_parser_generated.hpp).
+template <typename Enter, typename Leave, typename Expand, typename Match, typename Reduce, typename Unexpected,
+          typename Expression>
+struct RdSteps {
+    Enter& enterStep;
+    Leave& leaveStep;
+    Expand& expandStep;
+    Match& matchStep;
+    Reduce& reduceStep;
+    Unexpected& unexpectedStep;
+    Expression& expressionStep;
+
+    bool enter(int X) { return enterStep(X); }
+    void leave() { leaveStep(); }
+    int expand(int X) { return expandStep(X); }
+    void match(int a) { matchStep(a); }
+    void reduce(int X, int prod) { reduceStep(X, prod); }
+    void unexpected(int X, int prod) { unexpectedStep(X, prod); }
+    template <typename Operand>
+    bool expression(Operand operand) { return expressionStep(operand); }
+};
+
+template <typename Enter, typename Leave, typename Expand, typename Match, typename Reduce, typename Unexpected,
+          typename Expression>
+RdSteps<Enter, Leave, Expand, Match, Reduce, Unexpected, Expression> rdSteps(Enter& n, Leave& l, Expand& e, Match& m,
+                                                                            Reduce& r, Unexpected& u, Expression& x) {
+    return {n, l, e, m, r, u, x};
+}
+
 static ParseOutcome parseOneFile(const string& pathSrc,
                                  const Table& PT,
-                                 const string& startSym = "START") {
+                                 const ParserSymbols& N,
+                                 const SemanticActions& actions,
+                                 const DriverOptions& options) {
     ParseOutcome outcome;
     outcome.sourcePath = filesystem::path(pathSrc);
-
-    ifstream in(pathSrc);
-    if (!in) {
-        cerr << "Cannot open: " << pathSrc << "\n";
+    ParseStats& stats = outcome.stats;
+
+    // The lexer scans the mapped file (or the --stream window) in place;
+    // both must stay alive for as long as any Token is used below.
+    const bool streaming = options.streamWindow > 0;
+    auto phaseStart = StatsClock::now();
+    io::SourceBuffer source;
+    io::SourceWindow window;
+    try {
+        if (streaming) {
+            window = io::SourceWindow::open(pathSrc, options.streamWindow);
+        } else {
+            source = io::SourceBuffer::open(pathSrc);
+        }
+    } catch (const exception& ex) {
+        cerr << "Cannot open: " << pathSrc << " (" << ex.what() << ")\n";
         outcome.hadErrors = true;
         return outcome;
     }
-    string content((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    stats.loadMs = elapsedMs(phaseStart);
+    stats.sourceBytes = source.size();
+    stats.sourceMapped = source.isMapped();
 
     auto baseName = [](const string& p){
         size_t s = p.find_last_of("/\\");
@@ -1403,458 +1657,439 @@ static ParseOutcome parseOneFile(const string& pathSrc,
     filesystem::path srcPath(pathSrc);
     filesystem::path outputDir = srcPath.has_parent_path() ? srcPath.parent_path()
                                                            : filesystem::path(".");
+    if (!filesystem::is_regular_file(srcPath)) {
+        // Pipes and devices have no directory to write next to.
+        outputDir = filesystem::path("outputs");
+    }
 
-    filesystem::create_directories("outputs");
-    outcome.derivationPath = filesystem::path("outputs") / (base + ".outderivation");
-    outcome.errorPath = filesystem::path("outputs") / (base + ".outsyntaxerrors");
+    const unsigned emit = options.emit;
+    const bool buildAst = (emit & (kEmitAst | kEmitDot)) != 0;
+    if (emit != 0) {
+        filesystem::create_directories("outputs");
+    }
 
-    ofstream deriv(outcome.derivationPath);
-    ofstream errs(outcome.errorPath);
-    if (!deriv || !errs) {
-        cerr << "Cannot write outputs for " << pathSrc << "\n";
-        outcome.hadErrors = true;
-        return outcome;
+    ofstream deriv;
+    if (emit & kEmitDerivation) {
+        outcome.derivationLogPath = filesystem::path("outputs") / (base + ".outderivlog");
+        deriv.open(outcome.derivationLogPath);
+        if (!deriv) {
+            cerr << "Cannot write outputs for " << pathSrc << "\n";
+            outcome.hadErrors = true;
+            return outcome;
+        }
     }
 
-    auto emitError = [&](const auto&... parts) -> std::ostream& {
+    // The error file is created by the first error, so a clean parse leaves
+    // none; one left by an earlier run is removed up front.
+    const filesystem::path errorPath = filesystem::path("outputs") / (base + ".outsyntaxerrors");
+    if (emit & kEmitErrors) {
+        error_code ec;
+        filesystem::remove(errorPath, ec);
+    }
+    ofstream errs;
+    bool errsOpened = false;
+    // --check prints as it goes, except that the rd engine's messages are
+    // held until it is known not to hand the file to the table engine.
+    ostringstream rdCheckOut;
+    ostream* checkOut = (options.engine == Engine::Table) ? &cout : &rdCheckOut;
+    auto emitError = [&](const auto&... parts) {
         outcome.hadErrors = true;
+        if (options.check) {
+            *checkOut << pathSrc << ": ";
+            ((*checkOut << parts), ...);
+            return;
+        }
+        if (!(emit & kEmitErrors)) {
+            return;
+        }
+        if (!errsOpened) {
+            errsOpened = true;
+            errs.open(errorPath);
+            if (!errs) {
+                cerr << "Cannot write " << errorPath << "\n";
+            }
+            outcome.errorPath = errorPath;
+        }
         ((errs << parts), ...);
-        return errs;
     };
 
-    Lexer lx; lx.src = std::move(content);
-
-    struct PTok { string term; Token tok; };
-    vector<PTok> input;
-    vector<Token> allTokens;
+    phaseStart = StatsClock::now();
+    Lexer lx; lx.src = streaming ? window.view() : source.view();
+    // Positions are resolved from the newline index only for tokens that
+    // are printed or end up in the AST.
+    LineIndex lines;
+    auto positionOf = [&](const Token& tok) {
+        lines.extend(lx.src);
+        return lines.at(tok.offset);
+    };
 
-    while (true) {
-        Token t = lx.nextToken();
-        allTokens.push_back(t);
-        string a = tokToTerm(t);
-        if (a == "__SKIP__") {
-            continue;
-        }
-        if (a == "__LEXERR__") {
-            emitError("Syntax error due to lexical error at line ", t.line,
-                      " near \"", t.lexeme, "\".\n");
-            continue;
-        }
-        if (t.type == "eof") {
-            input.push_back({"$", t});
-            break;
-        }
-        if (a == "__UNKNOWN__") {
-            emitError("Unknown token \"", t.type, "\" at line ", t.line, ".\n");
-            continue;
+    ofstream tokOut;
+    auto writeTokenLine = [&](const Token& tok) {
+        const SourcePos pos = positionOf(tok);
+        tokOut << pos.line << ':' << pos.col << ' ' << tokenKindName(tok.kind);
+        if (tok.length != 0) {
+            tokOut << " \"" << lx.lexeme(tok) << "\"";
         }
-        input.push_back({a, t});
-    }
+        tokOut << " [" << PT.termName(PT.terminalOf(tok)) << "]\n";
+    };
 
-    outcome.tokensPath = outputDir / (base + ".outtokens");
-    {
-        ofstream tokOut(outcome.tokensPath);
+    // Batch mode keeps every token for .outtokens; streaming writes each one
+    // as soon as it is lexed. Without tokens in --emit they are only counted.
+    const bool emitTokens = (emit & kEmitTokens) != 0;
+    vector<Token> allTokens;
+    TokenStream::TokenSink onToken = [&](const Token&) { ++stats.tokenCount; };
+    if (emitTokens) {
+        outcome.tokensPath = outputDir / (base + ".outtokens");
+    }
+    if (emitTokens && streaming) {
+        tokOut.open(outcome.tokensPath);
         if (!tokOut) {
             emitError("Failed to write token stream output to ", outcome.tokensPath, "\n");
+        }
+        onToken = [&](const Token& t) {
+            ++stats.tokenCount;
+            if (tokOut) {
+                writeTokenLine(t);
+            }
+        };
+    } else if (emitTokens) {
+        onToken = [&](const Token& t) { allTokens.push_back(t); };
+    }
+    TokenStream input(PT, lx, lines, streaming ? &window : nullptr, emitTokens, onToken,
+                      [&](const Token& t, int term, SourcePos pos, string_view text) {
+        if (term == kTermLexErr) {
+            emitError("Syntax error due to lexical error at line ", pos.line, " near \"", text, "\".\n");
         } else {
-            for (const auto& tok : allTokens) {
-                tokOut << tok.line << ':' << tok.col << ' ' << tok.type;
-                if (!tok.lexeme.empty()) {
-                    tokOut << " \"" << tok.lexeme << "\"";
+            emitError("Unknown token \"", tokenKindName(t.kind), "\" at line ", pos.line, ".\n");
+        }
+    });
+
+    if (!streaming) {
+        input.lexAll(options.lexThreads);
+        stats.lexMs = elapsedMs(phaseStart);
+
+        if (emitTokens) {
+            stats.tokenCount = allTokens.size();
+            phaseStart = StatsClock::now();
+            tokOut.open(outcome.tokensPath);
+            if (!tokOut) {
+                emitError("Failed to write token stream output to ", outcome.tokensPath, "\n");
+            } else {
+                for (const auto& tok : allTokens) {
+                    writeTokenLine(tok);
                 }
-                tokOut << " [" << tokToTerm(tok) << "]\n";
             }
+            tokOut.close();
+            stats.writeMs += elapsedMs(phaseStart);
         }
     }
 
-    vector<string> stack; stack.push_back("$"); stack.push_back(startSym);
+    phaseStart = StatsClock::now();
+    const TermIds& T = PT.ids;
+    vector<StackEntry> stack{PT.stackEntry(T.eof), PT.stackEntry(N.start)};
 
     SemanticStack semStack;
     vector<ActionFrame> actionFrames;
 
-    vector<string> sentential = { startSym };
-    deriv << join(sentential) << "\n";
+    optional<DerivationLog> derivation;
+    if (deriv.is_open()) {
+        derivation.emplace(deriv, PT, N.start);
+    }
 
     size_t ip = 0;
-    auto isNonTerm = [&](const string& s){ return nontermIndex(PT, s) >= 0; };
+
+    // --stream: each completed top-level CLASSDECLORFUNCDEF subtree is
+    // written straight away and replaced by a null placeholder, so the
+    // Program node (and the REPTSTART0 lists above it) stay empty.
+    unique_ptr<ast::StreamWriter> astStream;
+    const filesystem::path astBasePath = outputDir / base;
+    auto streamTopLevelItem = [&]() {
+        ASTNode::Ptr item = semStack.pop();
+        semStack.push(nullptr);
+        if (!item) {
+            return;
+        }
+        try {
+            if (!astStream) {
+                astStream = make_unique<ast::StreamWriter>(ASTNode("Program"), astBasePath.string(),
+                                                           (emit & kEmitAst) != 0, (emit & kEmitDot) != 0);
+            }
+            astStream->writeChild(*item);
+        } catch (const exception& ex) {
+            emitError("Failed to write AST outputs: ", ex.what(), "\n");
+        }
+        // Terminals before the leftmost nonterminal are final; fold them
+        // into one "..." so the expanded lines do not grow with the file.
+        if (derivation) {
+            derivation->fold();
+        }
+    };
 
     auto performSemanticFrame = [&](const ActionFrame& frame) {
+        const RhsNames rhs = PT.rhs(frame.production);
         vector<ChildValue> childValues;
         bool underflow = false;
-        for (auto it = frame.rhs.rbegin(); it != frame.rhs.rend(); ++it) {
-            if (isEpsilonSymbol(*it)) {
+        for (size_t k = rhs.size(); k-- > 0;) {
+            if (isEpsilonSymbol(rhs[k])) {
                 continue;
             }
             if (semStack.empty()) {
                 underflow = true;
                 break;
             }
-            childValues.push_back({*it, semStack.pop()});
+            childValues.push_back({rhs[k], semStack.pop()});
         }
         if (underflow) {
-            emitError("Semantic stack underflow while processing ", frame.nonterminal, ".\n");
+            emitError("Semantic stack underflow while processing ", PT.symbols[static_cast<size_t>(frame.nonterminal)], ".\n");
             semStack.push(nullptr);
             return;
         }
         reverse(childValues.begin(), childValues.end());
-        auto result = buildSemanticNode(frame, childValues);
+        auto result = actions.reduce(PT, frame, childValues);
         semStack.push(result);
     };
 
-    while (!stack.empty()) {
-        string X = stack.back(); stack.pop_back();
-
-        if (isActionMarker(X)) {
-            const int idx = actionIndexFromMarker(X);
-            if (idx >= 0 && idx < static_cast<int>(actionFrames.size())) {
-                performSemanticFrame(actionFrames[idx]);
+    // The steps both engines take. matchTerminal consumes the lookahead if
+    // it is X, and otherwise reports it and skips it. chooseProduction
+    // returns the production for nonterminal X, or -1 once "no rule" is
+    // reported; expandStep also gives X a null value in that case. Once the
+    // rd parse is abandoned, neither reads or reports anything more.
+    bool abandoned = false;
+    auto matchTerminal = [&](int X) {
+        if (abandoned) {
+            if (buildAst) {
+                semStack.push(nullptr);
             }
-            continue;
+            return;
         }
-
-        const string a = (ip < input.size() ? input[ip].term : "$");
-
-        if (X == "$") {
-            if (a != "$") {
-                if (ip < input.size()) {
-                    emitError("Extra tokens at end near line ", input[ip].tok.line, ".\n");
+        const int a = (input.has(ip) ? input[ip].term : T.eof);
+        if (X == a) {
+            if (input.has(ip)) {
+                if (buildAst) {
+                    semStack.push(createNodeForTerminal(PT.symbols[X], input[ip].tok, positionOf(input[ip].tok), lx.lexeme(input[ip].tok)));
                 }
+                ip++;
+                input.releaseBefore(ip);
             }
-            break;
-        }
-
-        if (!isNonTerm(X)) {
-            if (X == a) {
-                if (ip < input.size()) {
-                    semStack.push(createNodeForTerminal(X, input[ip].tok));
-                    ip++;
-                }
-            } else {
-                if (ip < input.size()) {
-                    emitError("Syntax error: expected \"", X, "\" but found \"", a,
-                               "\" at line ", input[ip].tok.line, ".\n");
-                    semStack.push(nullptr);
-                    ip++;
-                } else {
+        } else {
+            if (input.has(ip)) {
+                emitError("Syntax error: expected \"", PT.symbols[X], "\" but found \"", PT.symbols[a],
+                           "\" at line ", positionOf(input[ip].tok).line, ".\n");
+                if (buildAst) {
                     semStack.push(nullptr);
                 }
+                ip++;
+                input.releaseBefore(ip);
+            } else if (buildAst) {
+                semStack.push(nullptr);
             }
-            continue;
         }
-
-        int i = nontermIndex(PT, X);
-        int j = termIndex(PT, a);
-        
-        // Apply heuristics BEFORE checking table
-        vector<string> rhs;
-        bool hasHeuristic = false;
-        
-        if (X == "FACTOR" && a == "id") {
-            // CRITICAL FIX: Grammar says FACTOR → id FACTOR2 REPTVARIABLEORFUNCTIONCALL
-            // but those nonterminals don't exist in the table!
-            // Table has VARIABLE and FUNCTIONCALL instead.
-            // Decide between them based on lookahead:
-            // - FUNCTIONCALL if we see: id ( or id.id( or id[...].id(
-            // - VARIABLE otherwise
-            
-            // Scan ahead to check the pattern
-            size_t look = ip + 1; // after the id
-            
-            // Skip array indices
-            while (look < input.size() && input[look].term == "lsqbr") {
-                int depth = 1;
-                look++;
-                while (look < input.size() && depth > 0) {
-                    if (input[look].term == "lsqbr") depth++;
-                    else if (input[look].term == "rsqbr") depth--;
-                    look++;
-                }
-            }
-            
-            bool isFunctionCall = false;
-            if (look < input.size()) {
-                if (input[look].term == "lpar") {
-                    // Simple function call: id(...)
-                    isFunctionCall = true;
-                } else if (input[look].term == "dot") {
-                    // Member access: id.something
-                    // Check if it leads to a function call
-                    look++; // skip dot
-                    if (look < input.size() && input[look].term == "id") {
-                        look++; // skip id
-                        // Skip more array indices after the member
-                        while (look < input.size() && input[look].term == "lsqbr") {
-                            int depth = 1;
-                            look++;
-                            while (look < input.size() && depth > 0) {
-                                if (input[look].term == "lsqbr") depth++;
-                                else if (input[look].term == "rsqbr") depth--;
-                                look++;
-                            }
-                        }
-                        if (look < input.size() && input[look].term == "lpar") {
-                            // Member function call: id.member(...)
-                            isFunctionCall = true;
-                        }
-                    }
-                }
-            }
-            
-            if (isFunctionCall) {
-                rhs = {"FUNCTIONCALL"};
-            } else {
-                rhs = {"VARIABLE"};
-            }
-            hasHeuristic = true;
-        } else if (X == "ARRAYSIZE" && a == "lsqbr") {
-            // ARRAYSIZE → [ ARRAYSIZE2, where ARRAYSIZE2 → intlit ] | ]
-            // Check if there's an intlit after the lsqbr
-            const string afterLsqbr = (ip + 1 < input.size() ? input[ip + 1].term : "$");
-            if (afterLsqbr == "intlit") {
-                rhs = {"lsqbr", "intlit", "rsqbr"};
-            } else {
-                // Empty array: []
-                rhs = {"lsqbr", "rsqbr"};
-            }
-            hasHeuristic = true;
-        } else if (X == "STATEMENT" && a == "id") {
-            // Table says STATEMENT → ASSIGNSTAT semi (for assignments)
-            // But need to handle function call statements too
-            // Check lookahead pattern to decide
-            const string next = (ip + 1 < input.size() ? input[ip + 1].term : "$");
-            
-            if (next == "lpar") {
-                // Simple function call: id(...)
-                rhs = {"FUNCTIONCALL", "semi"};
-                hasHeuristic = true;
-            } else if (next == "dot") {
-                // Member access - could be assignment (self.a = ...) or function call (obj.method(...))
-                // Scan ahead to determine
-                size_t look = ip + 2; // after id and dot
-                if (look < input.size() && input[look].term == "id") {
-                    look++; // after member id
-                    // Skip array indices
-                    while (look < input.size() && input[look].term == "lsqbr") {
-                        int depth = 1;
-                        look++;
-                        while (look < input.size() && depth > 0) {
-                            if (input[look].term == "lsqbr") depth++;
-                            else if (input[look].term == "rsqbr") depth--;
-                            look++;
-                        }
-                    }
-                    const string afterMember = (look < input.size() ? input[look].term : "$");
-                    if (afterMember == "lpar") {
-                        // Member function call: id.member(...)
-                        rhs = {"FUNCTIONCALL", "semi"};
-                        hasHeuristic = true;
-                    } else if (afterMember == "equal") {
-                        // Member assignment: id.member = ...
-                        // Can't use VARIABLE (doesn't handle member access properly in table)
-                        // Inline the pattern: id . id = EXPR semi
-                        // (simplified - doesn't handle id.member[idx] or id.member.member)
-                        rhs = {"id", "dot", "id", "equal", "EXPR", "semi"};
-                        hasHeuristic = true;
-                    } else if (afterMember == "dot") {
-                        // Chained member access - complex case
-                        // For now, use VARIABLE and let it handle
-                        rhs = {"VARIABLE", "ASSIGNOP", "EXPR", "semi"};
-                        hasHeuristic = true;
-                    }
-                }
+    };
+    auto chooseProduction = [&](int X) {
+        if (abandoned) {
+            return -1;
+        }
+        const int a = (input.has(ip) ? input[ip].term : T.eof);
+        int prod = N.cells.lookup(X - PT.termCount, a);
+        if (prod <= kDecide) {
+            prod = N.decisions[static_cast<size_t>(kDecide - prod)].run(input, ip + 1, T.eof);
+        }
+        if (prod < 0) {
+            if (input.has(ip)) {
+                emitError("Syntax error: no rule for ", PT.symbols[X], " with lookahead \"", PT.symbols[a],
+                           "\" at line ", positionOf(input[ip].tok).line, ". Recovering by popping.\n");
             } else {
-                // Simple assignment or array assignment - use table's ASSIGNSTAT
-                hasHeuristic = false;
+                emitError("Syntax error: no rule for ", PT.symbols[X], " with lookahead \"", PT.symbols[a],
+                           "\" at line EOF. Recovering by popping.\n");
             }
-        } else if (X == "REPTVARIABLE0" && a == "id") {
-            // REPTVARIABLE0 appears after id in VARIABLE/FUNCTIONCALL
-            // Table says: REPTVARIABLE0 → IDNEST REPTVARIABLE0 (with lookahead id)
-            // But IDNEST starts with dot, not id!
-            // So this table entry is wrong - REPTVARIABLE0 should only match on dot.
-            // Force epsilon for any lookahead except dot.
-            rhs = {"EPSILON"};
-            hasHeuristic = true;
-        } else if (X == "REPTVARIABLE0") {
-            // For any lookahead that's not dot, take epsilon
-            if (a != "dot") {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
-            }
-            // If lookahead is dot, let table handle it (IDNEST REPTVARIABLE0)
-        } else if (X == "REPTVARIABLE2") {
-            // REPTVARIABLE2 → INDICE REPTVARIABLE2 | EPSILON
-            // Only continue if we see lsqbr
-            if (a == "lsqbr") {
-                // Let table handle it
-                hasHeuristic = false;
-            } else {
-                // Anything else: epsilon
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+            if (derivation) {
+                derivation->noRule();
             }
-        } else if (X == "RIGHTRECTERM") {
-            // RIGHTRECTERM → MULTOP FACTOR RIGHTRECTERM | EPSILON
-            // Only continue if we see a multiplicative operator
-            if (a == "mult" || a == "div" || a == "and") {
-                hasHeuristic = false; // Let table handle it
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+            return -1;
+        }
+        if (derivation) {
+            derivation->expand(prod);
+        }
+        return prod;
+    };
+    auto expandStep = [&](int X) {
+        const int prod = chooseProduction(X);
+        if (prod < 0 && buildAst) {
+            semStack.push(nullptr);
+        }
+        return prod;
+    };
+    auto checkAtEnd = [&] {
+        if (input.has(ip) && input[ip].term != T.eof) {
+            emitError("Extra tokens at end near line ", positionOf(input[ip].tok).line, ".\n");
+        }
+    };
+
+    // Expressions: precedence climbing over N.exprLevels, one loop per
+    // level, folding each operator straight into a BinaryExpr where the
+    // stack would expand a RIGHTREC* tail per operator and fold the chain
+    // afterwards. It chooses, logs and reports every production the stack
+    // would, in the same order, so the derivation, the errors and the AST
+    // are the same. `operand` parses the operand nonterminal with the engine
+    // and leaves its value on semStack. Past kMaxExpressionDepth nested
+    // expressions it declines, and the engine expands the levels itself.
+    constexpr int kMaxExpressionDepth = 256;
+    int expressionDepth = 0;
+    auto parseLevel = [&](auto& self, size_t k, auto& operand) -> ASTNode::Ptr {
+        const OperatorLevel& level = N.exprLevels[k];
+        if (chooseProduction(level.head) < 0) {
+            return nullptr;
+        }
+        auto next = [&]() -> ASTNode::Ptr {
+            if (k + 1 < N.exprLevels.size()) {
+                return self(self, k + 1, operand);
+            }
+            operand();
+            return buildAst ? semStack.pop() : nullptr;
+        };
+        BinaryFold fold(next());
+        while (true) {
+            const int tail = chooseProduction(level.tail);
+            if (tail < 0 || PT.isEpsilon(tail)) {
+                break;
             }
-        } else if (X == "RIGHTRECARITHEXPR") {
-            // RIGHTRECARITHEXPR → ADDOP TERM RIGHTRECARITHEXPR | EPSILON
-            // Only continue if we see an additive operator
-            if (a == "plus" || a == "minus" || a == "or") {
-                hasHeuristic = false; // Let table handle it
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+            const int op = chooseProduction(level.op);
+            if (op >= 0) {
+                matchTerminal(PT.rhsSymbol(op, 0));
+                fold.add(buildAst ? semStack.pop() : nullptr);
             }
-        } else if (X == "REPTSTATBLOCK1") {
-            // REPTSTATBLOCK1 → STATEMENT REPTSTATBLOCK1 | EPSILON
-            // Check if lookahead can start a statement
-            if (a == "id" || a == "if" || a == "while" || a == "read" || 
-                a == "write" || a == "return") {
-                hasHeuristic = false; // Let table handle it
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+            fold.add(next());
+        }
+        return fold.result();
+    };
+    // Parses an expression at the first level's head, pushing its value;
+    // false if declined. The generated parser already walks the levels
+    // without a stack, so without an AST to build it keeps doing that.
+    auto parseExpression = [&](auto& operand) {
+        if (expressionDepth == kMaxExpressionDepth || (!buildAst && options.engine != Engine::Table)) {
+            return false;
+        }
+        ++expressionDepth;
+        ASTNode::Ptr value = parseLevel(parseLevel, 0, operand);
+        --expressionDepth;
+        if (buildAst) {
+            semStack.push(std::move(value));
+        }
+        return true;
+    };
+    const int exprHead = N.exprLevels.empty() ? -1 : N.exprLevels.front().head;
+
+    if (options.engine != Engine::Table) {
+        // Nested past kMaxRdDepth, the parse is abandoned rather than run
+        // out of stack: the functions already entered unwind with null
+        // values, and the caller parses the file again with the table.
+        int rdDepth = 0;
+        auto enterStep = [&](int) {
+            if (!abandoned && rdDepth < kMaxRdDepth) {
+                ++rdDepth;
+                return true;
+            }
+            abandoned = true;
+            if (buildAst) {
+                semStack.push(nullptr);
             }
-        } else if (X == "REPTFUNCBODY1") {
-            // REPTFUNCBODY1 → LOCALVARDECLORSTMT REPTFUNCBODY1 | EPSILON
-            // Check if lookahead can start a local var or statement
-            if (a == "localvar" || a == "id" || a == "if" || a == "while" || 
-                a == "read" || a == "write" || a == "return") {
-                hasHeuristic = false; // Let table handle it
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+            return false;
+        };
+        auto leaveStep = [&] { --rdDepth; };
+        auto reduceStep = [&](int X, int prod) {
+            if (buildAst) {
+                performSemanticFrame({X, prod});
+            }
+        };
+        auto unexpectedStep = [&](int X, int prod) {
+            emitError("Internal error: no generated case for production ", prod, " of ", PT.symbols[X],
+                      "; rerun tools/gen_rd_parser.\n");
+            if (buildAst) {
+                semStack.push(nullptr);
             }
-        } else if (X == "REPTSTART0" && a == "$") {
-            rhs = {"EPSILON"};
-            hasHeuristic = true;
-        } else if (X == "IDNEST") {
-            // CRITICAL FIX: The parsing table has wrong entry for IDNEST.
-            // Table says: IDNEST → id REPTIDNEST1 dot (with lookahead id)
-            // Grammar says: IDNEST → dot id IDNEST2
-            // We must override the table and use the correct grammar production.
-            if (a == "dot") {
-                // Check what follows: dot id ...
-                const string afterDot = (ip + 1 < input.size() ? input[ip + 1].term : "$");
-                if (afterDot == "id") {
-                    const string afterId = (ip + 2 < input.size() ? input[ip + 2].term : "$");
-                    if (afterId == "lpar") {
-                        // dot id ( ... ) - method call
-                        rhs = {"dot", "id", "lpar", "APARAMS", "rpar"};
-                        hasHeuristic = true;
-                    } else {
-                        // dot id [array] or dot id - field access
-                        rhs = {"dot", "id", "REPTIDNEST1"};
-                        hasHeuristic = true;
+        };
+        auto steps = rdSteps(enterStep, leaveStep, expandStep, matchTerminal, reduceStep, unexpectedStep,
+                             parseExpression);
+        rd_parser::Parser<decltype(steps)>(steps).parse();
+        if (abandoned) {
+            outcome.rdTooDeep = true;
+            return outcome;
+        }
+        cout << rdCheckOut.str();
+        checkOut = &cout;
+        checkAtEnd();
+    }
+
+    // The table loop, until the stack is back down to `base` entries. An
+    // expression's operands are parsed by a nested run above the entry
+    // they started from.
+    auto runTable = [&](auto& self, size_t base) -> void {
+        while (stack.size() > base) {
+            const StackEntry top = stack.back(); stack.pop_back();
+
+            if (top.tag() == StackTag::Action) {
+                const int idx = top.payload();
+                if (idx >= 0 && idx < static_cast<int>(actionFrames.size())) {
+                    performSemanticFrame(actionFrames[idx]);
+                    if (streaming && actionFrames[idx].nonterminal == N.CLASSDECLORFUNCDEF) {
+                        streamTopLevelItem();
                     }
+                    // Every frame created after this one belonged to its
+                    // right-hand side and has already run, so the pending
+                    // frames form a stack as deep as the parse stack.
+                    actionFrames.resize(static_cast<size_t>(idx));
                 }
+                continue;
             }
-            // If lookahead is not dot, or pattern doesn't match, reject (no heuristic)
-        } else if (X == "REPTVARIABLEORFUNCTIONCALL") {
-            // REPTVARIABLEORFUNCTIONCALL → IDNEST REPTVARIABLEORFUNCTIONCALL | EPSILON
-            // IDNEST starts with dot, so only continue if we see dot
-            if (a == "dot") {
-                hasHeuristic = false; // Let table handle it
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
+
+            const int X = top.payload();
+            if (X == T.eof) {
+                checkAtEnd();
+                break;
             }
-        } else if (X == "REPTFUNCTIONCALL0" && a == "id") {
-            bool isIdnest = false;
-            size_t look = ip + 1;
-            while (look < input.size() && input[look].term == "lsqbr") {
-                int depth = 1;
-                look++;
-                while (look < input.size() && depth > 0) {
-                    if (input[look].term == "lsqbr") depth++;
-                    else if (input[look].term == "rsqbr") depth--;
-                    look++;
-                }
+            if (top.tag() == StackTag::Terminal) {
+                matchTerminal(X);
+                continue;
             }
-            if (look < input.size()) {
-                if (input[look].term == "dot") {
-                    isIdnest = true;
-                } else if (input[look].term == "lpar") {
-                    int depth = 1;
-                    look++;
-                    while (look < input.size() && depth > 0) {
-                        if (input[look].term == "lpar") depth++;
-                        else if (input[look].term == "rpar") depth--;
-                        look++;
-                    }
-                    if (look < input.size() && input[look].term == "dot") {
-                        isIdnest = true;
-                    }
+            if (X == exprHead) {
+                auto operand = [&] {
+                    stack.push_back(PT.stackEntry(N.exprOperand));
+                    self(self, stack.size() - 1);
+                };
+                if (parseExpression(operand)) {
+                    continue;
                 }
             }
-            if (isIdnest) {
-                rhs = {"IDNEST", "REPTFUNCTIONCALL0"};
-                hasHeuristic = true;
-            } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
-            }
-        } else if (X == "LOCALVARDECL" && a == "localvar") {
-            const string afterType = (ip + 4 < input.size() ? input[ip + 4].term : "$");
-            if (afterType == "lpar") {
-                rhs = {"localvar", "id", "colon", "TYPE", "lpar", "APARAMS", "rpar", "semi"};
-                hasHeuristic = true;
+
+            const int prod = expandStep(X);
+            if (prod < 0) {
+                continue;
             }
-        } else if (X == "OPTFUNCHEAD1" && a == "id") {
-            const string next = (ip + 1 < input.size() ? input[ip + 1].term : "$");
-            if (next == "sr") {
-                rhs = {"id", "sr"};
-                hasHeuristic = true;
+            const bool isEpsilon = PT.isEpsilon(prod);
+            if (!buildAst) {
+                // No semantic actions to schedule.
+            } else if (streaming && X == N.REPTSTART0 && !isEpsilon && continuesTopLevelList(PT, stack, actionFrames, semStack)) {
+                // REPTSTART0 -> CLASSDECLORFUNCDEF REPTSTART0 in tail position of
+                // the previous REPTSTART0: its item was streamed out, so reuse
+                // that frame instead of nesting a new one per top-level item.
+                semStack.pop();
             } else {
-                rhs = {"EPSILON"};
-                hasHeuristic = true;
-            }
-        } else if (X == "FUNCHEAD" && a == "function") {
-            const string next1 = (ip + 1 < input.size() ? input[ip + 1].term : "$");
-            const string next2 = (ip + 2 < input.size() ? input[ip + 2].term : "$");
-            const string next3 = (ip + 3 < input.size() ? input[ip + 3].term : "$");
-            if (next1 == "id" && next2 == "sr" && next3 == "constructor") {
-                rhs = {"function", "id", "sr", "constructor", "lpar", "FPARAMS", "rpar"};
-                hasHeuristic = true;
+                const int actionIdx = static_cast<int>(actionFrames.size());
+                actionFrames.push_back({X, prod});
+                stack.push_back(StackEntry::make(StackTag::Action, actionIdx));
             }
-        }
-        
-        if (!hasHeuristic) {
-            if (i < 0 || j < 0 || PT.map[i][j].empty()) {
-                if (ip < input.size()) {
-                    emitError("Syntax error: no rule for ", X, " with lookahead \"", a,
-                               "\" at line ", input[ip].tok.line, ". Recovering by popping.\n");
-                } else {
-                    emitError("Syntax error: no rule for ", X, " with lookahead \"", a,
-                               "\" at line EOF. Recovering by popping.\n");
-                }
-                applyLeftmost(sentential, {"EPSILON"});
-                deriv << join(sentential) << "\n";
-                semStack.push(nullptr);
-                continue;
-            }
-            rhs = PT.map[i][j];
-        }
-        ActionFrame frame{X, rhs};
-        int actionIdx = static_cast<int>(actionFrames.size());
-        actionFrames.push_back(frame);
-        stack.push_back(makeActionMarker(actionIdx));
 
-        if (!(rhs.size() == 1 && rhs[0] == "EPSILON")) {
-            for (int k = static_cast<int>(rhs.size()) - 1; k >= 0; --k) {
-                stack.push_back(rhs[k]);
-            }
+            stack.insert(stack.end(), PT.prodEntries.begin() + PT.prodStart[prod],
+                         PT.prodEntries.begin() + PT.prodStart[prod + 1]);
         }
-
-        applyLeftmost(sentential, rhs);
-        deriv << join(sentential) << "\n";
+    };
+    if (options.engine == Engine::Table) {
+        runTable(runTable, 0);
     }
 
+    stats.parseMs = elapsedMs(phaseStart);
+
+    phaseStart = StatsClock::now();
     ASTNode::Ptr root;
     if (!semStack.empty()) {
         root = semStack.pop();
@@ -1864,16 +2099,45 @@ static ParseOutcome parseOneFile(const string& pathSrc,
                    " leftover entries after parsing.\n");
     }
 
-    if (root) {
-        try {
-            const filesystem::path astBasePath = outputDir / base;
-            const auto astBaseStr = astBasePath.string();
-            ast::writeText(*root, astBaseStr);
-            ast::writeDot(*root, astBaseStr);
+    auto recordAstPaths = [&] {
+        if (emit & kEmitAst) {
             outcome.astTextPath = astBasePath;
             outcome.astTextPath += ".outast";
+        }
+        if (emit & kEmitDot) {
             outcome.astDotPath = astBasePath;
             outcome.astDotPath += ".dot";
+        }
+    };
+    if (!buildAst) {
+        // --emit without ast or dot: nothing was built.
+    } else if (astStream) {
+        try {
+            if (root) {
+                for (const auto& child : root->getChildren()) {
+                    if (child) {
+                        astStream->writeChild(*child);
+                    }
+                }
+            }
+            astStream->finish();
+            recordAstPaths();
+        } catch (const exception& ex) {
+            emitError("Failed to write AST outputs: ", ex.what(), "\n");
+        }
+        if (!root) {
+            emitError("No AST root generated for this translation unit.\n");
+        }
+    } else if (root) {
+        try {
+            const auto astBaseStr = astBasePath.string();
+            if (emit & kEmitAst) {
+                ast::writeText(*root, astBaseStr);
+            }
+            if (emit & kEmitDot) {
+                ast::writeDot(*root, astBaseStr);
+            }
+            recordAstPaths();
         } catch (const exception& ex) {
             emitError("Failed to write AST outputs: ", ex.what(), "\n");
         }
@@ -1881,44 +2145,301 @@ static ParseOutcome parseOneFile(const string& pathSrc,
         emitError("No AST root generated for this translation unit.\n");
     }
 
-    if (ip + 1 < input.size()) {
-        if (ip < input.size()) {
-            emitError("Syntax error: unparsed input remains near line ", input[ip].tok.line, ".\n");
+    if (input.has(ip + 1)) {
+        if (input.has(ip)) {
+            emitError("Syntax error: unparsed input remains near line ", positionOf(input[ip].tok).line, ".\n");
         } else {
             emitError("Syntax error: unparsed input remains near line EOF.\n");
         }
     }
+    input.drain();
+    if (streaming) {
+        stats.sourceBytes = static_cast<size_t>(window.bytesRead());
+        stats.streamed = true;
+    }
+    if (options.expandDerivation && derivation) {
+        deriv.close();
+        outcome.derivationPath = filesystem::path("outputs") / (base + ".outderivation");
+        ifstream log(outcome.derivationLogPath);
+        ofstream text(outcome.derivationPath);
+        try {
+            if (!log || !text) {
+                throw runtime_error("cannot open " + outcome.derivationPath.string());
+            }
+            expandDerivation(log, text);
+        } catch (const exception& ex) {
+            emitError("Failed to expand the derivation: ", ex.what(), "\n");
+        }
+    }
+    stats.writeMs += elapsedMs(phaseStart);
+
+    return outcome;
+}
+
+struct EngineTimes {
+    double tableMs = 0;
+    double rdMs = 0;
+    size_t mismatches = 0;
+};
+
+static string readWholeFile(const filesystem::path& path) {
+    ifstream in(path, ios::binary);
+    return string((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+}
 
+// --engine=diff: parses with the table engine (all requested outputs), then
+// again with the generated parser writing only .outast, and compares the
+// two. On a mismatch the table engine's .outast is kept and the other is
+// left next to it as .rd.outast.
+static ParseOutcome parseWithBothEngines(const string& pathSrc, const Table& PT, const ParserSymbols& N,
+                                         const SemanticActions& actions, const DriverOptions& options,
+                                         EngineTimes& totals) {
+    DriverOptions tableRun = options;
+    tableRun.engine = Engine::Table;
+    ParseOutcome outcome = parseOneFile(pathSrc, PT, N, actions, tableRun);
+
+    DriverOptions rdRun = options;
+    rdRun.engine = Engine::RecursiveDescent;
+    rdRun.emit = kEmitAst;
+    rdRun.expandDerivation = false;
+    rdRun.stats = false;
+    const string tableAst = outcome.astTextPath.empty() ? string() : readWholeFile(outcome.astTextPath);
+    const ParseOutcome rd = parseOneFile(pathSrc, PT, N, actions, rdRun);
+    const string rdAst = rd.astTextPath.empty() ? string() : readWholeFile(rd.astTextPath);
+
+    if (rd.rdTooDeep) {
+        // Not a mismatch: rd hands such a file to the table engine, whose
+        // outputs are the ones kept here anyway.
+        cout << "[ENGINE] " << outcome.sourcePath << ": table " << outcome.stats.parseMs
+             << " ms, rd stopped at " << kMaxRdDepth << " levels of nesting\n";
+        return outcome;
+    }
+    totals.tableMs += outcome.stats.parseMs;
+    totals.rdMs += rd.stats.parseMs;
+    cout << "[ENGINE] " << outcome.sourcePath << ": table " << outcome.stats.parseMs << " ms, rd "
+         << rd.stats.parseMs << " ms";
+    if (tableAst == rdAst && outcome.astTextPath == rd.astTextPath && outcome.hadErrors == rd.hadErrors) {
+        cout << ", .outast identical\n";
+        return outcome;
+    }
+    ++totals.mismatches;
+    cout << ", .outast DIFFERS";
+    if (!rd.astTextPath.empty()) {
+        filesystem::path kept = rd.astTextPath;
+        kept.replace_extension(".rd.outast");
+        ofstream(kept, ios::binary) << rdAst;
+        cout << " (rd output in " << kept << ')';
+    }
+    if (!outcome.astTextPath.empty()) {
+        ofstream(outcome.astTextPath, ios::binary) << tableAst;
+    }
+    cout << '\n';
+    outcome.hadErrors = true;
     return outcome;
 }
 
+static void printStats(const filesystem::path& file, const ParseStats& st) {
+    cout << "[STATS] " << file << ": " << st.sourceBytes << " bytes ("
+         << (st.streamed ? "stream" : st.sourceMapped ? "mmap" : "read") << "), "
+         << st.tokenCount << " tokens\n";
+    if (st.streamed) {
+        cout << "[STATS]   load " << st.loadMs << " ms, lex + parse + write " << st.parseMs << " ms\n";
+    } else {
+        cout << "[STATS]   load " << st.loadMs << " ms, lex " << st.lexMs << " ms, parse "
+             << st.parseMs << " ms, write " << st.writeMs << " ms\n";
+    }
+    // From the load already timed; a mapped file's pages are read in as
+    // the lexer reaches them, so that cost is part of lex. --stream reads
+    // as it parses and has no separate load.
+    const double mb = static_cast<double>(st.sourceBytes) / (1024.0 * 1024.0);
+    if (!st.streamed && mb > 0) {
+        cout << "[STATS]   read " << st.sourceBytes << " bytes in " << st.loadMs << " ms ("
+             << st.loadMs / mb << " ms/MB)\n";
+    }
+}
+
 int main(int argc, char** argv) {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
 
-    if (argc < 3) {
-        cerr << "Usage: ./parserdriver <parsing_table.csv> <path-or-glob>...\n";
+    DriverOptions options;
+    string expandLogPath;
+    vector<string> positional;
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg == "--stats") {
+            options.stats = true;
+        } else if (arg == "--stream") {
+            options.streamWindow = kDefaultStreamWindow;
+        } else if (arg.rfind("--stream=", 0) == 0) {
+            try {
+                options.streamWindow = stoul(arg.substr(9));
+            } catch (const exception&) {
+                options.streamWindow = 0;
+            }
+            if (options.streamWindow == 0) {
+                cerr << "Invalid window size in " << arg << "\n";
+                return 1;
+            }
+        } else if (arg.rfind("--lex-threads=", 0) == 0) {
+            try {
+                options.lexThreads = static_cast<unsigned>(stoul(arg.substr(14)));
+            } catch (const exception&) {
+                options.lexThreads = 0;
+            }
+            if (options.lexThreads == 0) {
+                cerr << "Invalid thread count in " << arg << "\n";
+                return 1;
+            }
+        } else if (arg.rfind("--compile-table=", 0) == 0) {
+            options.compileTablePath = arg.substr(16);
+            if (options.compileTablePath.empty()) {
+                cerr << "Missing output path in " << arg << "\n";
+                return 1;
+            }
+        } else if (arg.rfind("--emit=", 0) == 0) {
+            if (!parseEmitList(arg.substr(7), options.emit)) {
+                cerr << "Unknown output in " << arg << " (expected ast, dot, tokens, derivation, errors)\n";
+                return 1;
+            }
+        } else if (arg.rfind("--engine=", 0) == 0) {
+            const string engine = arg.substr(9);
+            if (engine == "table") {
+                options.engine = Engine::Table;
+            } else if (engine == "rd") {
+                options.engine = Engine::RecursiveDescent;
+            } else if (engine == "diff") {
+                options.engine = Engine::Differential;
+            } else {
+                cerr << "Unknown engine in " << arg << " (expected table, rd or diff)\n";
+                return 1;
+            }
+        } else if (arg == "--check") {
+            options.check = true;
+        } else if (arg == "--expand-derivation") {
+            options.expandDerivation = true;
+        } else if (arg.rfind("--expand-derivation=", 0) == 0) {
+            expandLogPath = arg.substr(20);
+            if (expandLogPath.empty()) {
+                cerr << "Missing log path in " << arg << "\n";
+                return 1;
+            }
+        } else if (arg.rfind("--", 0) == 0) {
+            cerr << "Unknown option " << arg << "\n";
+            return 1;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (options.check) {
+        if (options.emit != kEmitAll || options.expandDerivation) {
+            cerr << "--check writes no files; it cannot be combined with --emit or --expand-derivation\n";
+            return 1;
+        }
+        options.emit = 0;
+    }
+    if (options.engine != Engine::Table && options.streamWindow > 0) {
+        cerr << "--stream needs --engine=table\n";
+        return 1;
+    }
+    if (options.engine == Engine::Differential) {
+        if (options.check) {
+            cerr << "--engine=diff compares ASTs; it cannot be combined with --check\n";
+            return 1;
+        }
+        options.emit |= kEmitAst;
+    }
+    if (options.expandDerivation && !(options.emit & kEmitDerivation)) {
+        cerr << "--expand-derivation needs derivation in --emit\n";
+        return 1;
+    }
+
+    // Offline expansion needs no table: the log spells out each production.
+    if (!expandLogPath.empty()) {
+        if (!positional.empty()) {
+            cerr << "Usage: ./parserdriver --expand-derivation=<file.outderivlog>\n";
+            return 1;
+        }
+        ifstream log(expandLogPath);
+        if (!log) {
+            cerr << "Cannot open " << expandLogPath << "\n";
+            return 1;
+        }
+        try {
+            expandDerivation(log, cout);
+        } catch (const exception& ex) {
+            cerr << expandLogPath << ": " << ex.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    // The table is embedded at build time; a leading .csv or .tbl argument,
+    // or a .grm grammar to generate it from, overrides it at run time.
+    string tablePath;
+    if (!positional.empty() && isTableFile(positional.front())) {
+        tablePath = positional.front();
+        positional.erase(positional.begin());
+    }
+
+    if (!options.compileTablePath.empty()) {
+        if (!positional.empty()) {
+            cerr << "Usage: ./parserdriver --compile-table=<out.tbl> [parsing_table.csv|.tbl|grammar.grm]\n";
+            return 1;
+        }
+    } else if (positional.empty()) {
+        cerr << "Usage: ./parserdriver [--stats] [--stream[=<window-bytes>]] [--lex-threads=N] [--emit=<outputs>] [--expand-derivation] [--check] [--engine=table|rd|diff] [parsing_table.csv|.tbl|grammar.grm] <path-or-glob>...\n";
+        cerr << "       ./parserdriver --compile-table=<out.tbl> [parsing_table.csv|.tbl|grammar.grm]\n";
+        cerr << "       ./parserdriver --expand-derivation=<file.outderivlog>\n";
         return 1;
     }
 
     Table PT;
     try {
-        PT = loadTable(argv[1]);
+        if (tablePath.empty()) {
+            PT = loadEmbeddedTable();
+        } else if (filesystem::path(tablePath).extension() == ".grm") {
+            PT = loadGrammarTable(tablePath);
+        } else {
+            PT = loadTable(tablePath);
+        }
     } catch (const exception& ex) {
         cerr << "Failed to load parsing table: " << ex.what() << "\n";
         return 1;
     }
 
+    if (!options.compileTablePath.empty()) {
+        try {
+            // With the overrides' right-hand sides in the pool, a loaded
+            // table is used as mapped.
+            prepareParserSymbols(PT, "START");
+            writeCompiledTable(PT, options.compileTablePath);
+        } catch (const exception& ex) {
+            cerr << "Failed to compile parsing table: " << ex.what() << "\n";
+            return 1;
+        }
+        cout << "[OK]   " << (tablePath.empty() ? "embedded table" : tablePath) << " -> "
+             << options.compileTablePath << '\n';
+        return 0;
+    }
+
     if (nontermIndex(PT, "START") < 0) {
         cerr << "[WARN] Parsing table does not define START; defaulting to START with REPTSTART0.\n";
     }
     cerr << "[DEBUG] term index of class = " << termIndex(PT, "class") << "\n";
     cerr << "[DEBUG] nonterm index of START = " << nontermIndex(PT, "START") << "\n";
+    const ParserSymbols symbols = prepareParserSymbols(PT, "START");
+    if (options.engine != Engine::Table && decisionFingerprint(PT, symbols) != rd_parser::kFingerprint) {
+        cerr << "rd_parser_generated.hpp was generated from another table or other lookahead decisions; "
+                "use --engine=table or rerun tools/gen_rd_parser and rebuild.\n";
+        return 1;
+    }
+    const SemanticActions actions(PT);
 
     vector<filesystem::path> files;
     bool hadMissing = false;
-    for (int i = 2; i < argc; ++i) {
-        const string spec = argv[i];
+    for (const string& spec : positional) {
         auto expanded = expandInputSpec(spec);
         if (expanded.empty()) {
             cerr << "No source files matched \"" << spec << "\".\n";
@@ -1937,8 +2458,27 @@ int main(int argc, char** argv) {
     files.erase(unique(files.begin(), files.end()), files.end());
 
     bool anyErrors = false;
+    ParseStats totals;
+    totals.sourceMapped = true;
+    EngineTimes engineTotals;
     for (const auto& file : files) {
-        const ParseOutcome outcome = parseOneFile(file.string(), PT);
+        ParseOutcome outcome;
+        try {
+            outcome = options.engine == Engine::Differential
+                          ? parseWithBothEngines(file.string(), PT, symbols, actions, options, engineTotals)
+                          : parseOneFile(file.string(), PT, symbols, actions, options);
+            if (outcome.rdTooDeep) {
+                logWarn(file.string() + " is nested more than " + to_string(kMaxRdDepth) +
+                        " levels deep for --engine=rd; parsing it with the table engine.");
+                DriverOptions tableRun = options;
+                tableRun.engine = Engine::Table;
+                outcome = parseOneFile(file.string(), PT, symbols, actions, tableRun);
+            }
+        } catch (const exception& ex) {
+            // A --stream window that cannot be refilled or grown.
+            cerr << "Cannot parse: " << file.string() << " (" << ex.what() << ")\n";
+            outcome.hadErrors = true;
+        }
         if (outcome.hadErrors) {
             anyErrors = true;
             cout << "[FAIL] " << file;
@@ -1950,12 +2490,46 @@ int main(int argc, char** argv) {
             cout << "[OK]   " << file;
             if (!outcome.astTextPath.empty() && !outcome.astDotPath.empty()) {
                 cout << " -> " << outcome.astTextPath << ", " << outcome.astDotPath;
+            } else if (!outcome.astTextPath.empty()) {
+                cout << " -> " << outcome.astTextPath;
+            } else if (!outcome.astDotPath.empty()) {
+                cout << " -> " << outcome.astDotPath;
             }
             if (!outcome.tokensPath.empty()) {
                 cout << " (tokens: " << outcome.tokensPath << ')';
             }
             cout << '\n';
         }
+        if (options.stats) {
+            printStats(file, outcome.stats);
+            const ParseStats& st = outcome.stats;
+            totals.sourceMapped = totals.sourceMapped && st.sourceMapped;
+            totals.streamed = st.streamed;
+            totals.sourceBytes += st.sourceBytes;
+            totals.tokenCount += st.tokenCount;
+            totals.loadMs += st.loadMs;
+            totals.lexMs += st.lexMs;
+            totals.parseMs += st.parseMs;
+            totals.writeMs += st.writeMs;
+        }
+    }
+
+    if (options.stats && files.size() > 1) {
+        printStats("total", totals);
+    }
+    if (options.engine == Engine::Differential) {
+        cout << "[ENGINE] total: table " << engineTotals.tableMs << " ms, rd " << engineTotals.rdMs << " ms ("
+             << engineTotals.tableMs / max(engineTotals.rdMs, 1e-9) << "x), " << engineTotals.mismatches
+             << " .outast mismatch(es)\n";
+        if (engineTotals.mismatches) {
+            anyErrors = true;
+        }
+    }
+    if (options.stats && totals.parseMs > 0) {
+        cout << "[STATS] throughput: " << totals.tokenCount / ((totals.lexMs + totals.parseMs) / 1e3)
+             << " tokens/s (lex + parse), "
+             << totals.tokenCount / ((totals.lexMs + totals.parseMs + totals.writeMs) / 1e3)
+             << " tokens/s (lex + parse + write)\n";
     }
 
     if (anyErrors) {
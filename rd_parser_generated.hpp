@@ -0,0 +1,1365 @@
+// Generated by tools/gen_rd_parser.cpp from grammar/parsing_table.csv.
+// Do not edit; rerun the generator after changing the table or the
+// lookahead decisions in parser_decisions.cpp.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rd_parser {
+
+// decisionFingerprint of the table and decisions this was generated from.
+inline constexpr std::uint64_t kFingerprint = 0x673b5849d7133dc0ull;
+
+// One function per nonterminal. Ctx supplies the driver's steps:
+//   bool enter(int X)              X's function is starting; false to
+//                                  return at once, X's value supplied
+//   void leave()                   an entered function is returning
+//   int expand(int X)              production chosen for X (logged), or -1
+//                                  once "no rule" has been reported
+//   void match(int a)              terminal a
+//   void reduce(int X, int p)      X's semantic action for production p
+//   void unexpected(int X, int p)  p is not a production X was generated for
+//   bool expression(F operand)     parse the operator levels below here,
+//                                  calling operand() for each operand;
+//                                  false to have this function do it
+template <typename Ctx>
+class Parser {
+public:
+    explicit Parser(Ctx& ctx) : c(ctx) {}
+
+    void parse() { nt_START(); }
+
+private:
+    // Leaves the function it was made in on every return.
+    struct Level {
+        Ctx& c;
+        ~Level() { c.leave(); }
+    };
+
+    Ctx& c;
+
+    void nt_ADDOP();
+    void nt_APARAMS();
+    void nt_APARAMSTAIL();
+    void nt_ARITHEXPR();
+    void nt_ARRAYSIZE();
+    void nt_ASSIGNOP();
+    void nt_ASSIGNSTAT();
+    void nt_CLASSDECL();
+    void nt_CLASSDECLORFUNCDEF();
+    void nt_EXPR();
+    void nt_FACTOR();
+    void nt_FPARAMS();
+    void nt_FPARAMSTAIL();
+    void nt_FUNCBODY();
+    void nt_FUNCDEF();
+    void nt_FUNCHEAD();
+    void nt_FUNCTIONCALL();
+    void nt_IDNEST();
+    void nt_INDICE();
+    void nt_LOCALVARDECL();
+    void nt_LOCALVARDECLORSTMT();
+    void nt_MEMBERDECL();
+    void nt_MEMBERFUNCDECL();
+    void nt_MEMBERVARDECL();
+    void nt_MULTOP();
+    void nt_OPTCLASSDECL2();
+    void nt_OPTFUNCHEAD1();
+    void nt_RELEXPR();
+    void nt_RELOP();
+    void nt_REPTAPARAMS1();
+    void nt_REPTCLASSDECL4();
+    void nt_REPTFPARAMS3();
+    void nt_REPTFPARAMS4();
+    void nt_REPTFPARAMSTAIL4();
+    void nt_REPTFUNCBODY1();
+    void nt_REPTFUNCTIONCALL0();
+    void nt_REPTIDNEST1();
+    void nt_REPTLOCALVARDECL4();
+    void nt_REPTMEMBERVARDECL4();
+    void nt_REPTOPTCLASSDECL22();
+    void nt_REPTSTART0();
+    void nt_REPTSTATBLOCK1();
+    void nt_REPTVARIABLE0();
+    void nt_REPTVARIABLE2();
+    void nt_RETURNTYPE();
+    void nt_RIGHTRECARITHEXPR();
+    void nt_RIGHTRECTERM();
+    void nt_SIGN();
+    void nt_START();
+    void nt_STATBLOCK();
+    void nt_STATEMENT();
+    void nt_TERM();
+    void nt_TYPE();
+    void nt_VARIABLE();
+    void nt_VISIBILITY();
+};
+
+template <typename Ctx>
+void Parser<Ctx>::nt_ADDOP() {
+    if (!c.enter(48)) return;   // ADDOP
+    const Level level{c};
+    const int p = c.expand(48);
+    switch (p) {
+    case 0:   // minus
+        c.match(18);   // minus
+        c.reduce(48, p);
+        break;
+    case 1:   // plus
+        c.match(19);   // plus
+        c.reduce(48, p);
+        break;
+    case 2:   // or
+        c.match(47);   // or
+        c.reduce(48, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(48, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_APARAMS() {
+    if (!c.enter(49)) return;   // APARAMS
+    const Level level{c};
+    const int p = c.expand(49);
+    switch (p) {
+    case 3:   // EXPR REPTAPARAMS1
+        nt_EXPR();
+        nt_REPTAPARAMS1();
+        c.reduce(49, p);
+        break;
+    case 4:   // EPSILON
+        c.reduce(49, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(49, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_APARAMSTAIL() {
+    if (!c.enter(50)) return;   // APARAMSTAIL
+    const Level level{c};
+    const int p = c.expand(50);
+    switch (p) {
+    case 5:   // comma EXPR
+        c.match(21);   // comma
+        nt_EXPR();
+        c.reduce(50, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(50, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_ARITHEXPR() {
+    if (!c.enter(51)) return;   // ARITHEXPR
+    const Level level{c};
+    if (c.expression([this] { nt_FACTOR(); })) return;
+    const int p = c.expand(51);
+    switch (p) {
+    case 6:   // TERM RIGHTRECARITHEXPR
+        nt_TERM();
+        nt_RIGHTRECARITHEXPR();
+        c.reduce(51, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(51, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_ARRAYSIZE() {
+    if (!c.enter(52)) return;   // ARRAYSIZE
+    const Level level{c};
+    const int p = c.expand(52);
+    switch (p) {
+    case 7:   // lsqbr intlit rsqbr
+        c.match(40);   // lsqbr
+        c.match(44);   // intlit
+        c.match(39);   // rsqbr
+        c.reduce(52, p);
+        break;
+    case 83:   // lsqbr rsqbr
+        c.match(40);   // lsqbr
+        c.match(39);   // rsqbr
+        c.reduce(52, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(52, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_ASSIGNOP() {
+    if (!c.enter(53)) return;   // ASSIGNOP
+    const Level level{c};
+    const int p = c.expand(53);
+    switch (p) {
+    case 8:   // equal
+        c.match(46);   // equal
+        c.reduce(53, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(53, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_ASSIGNSTAT() {
+    if (!c.enter(54)) return;   // ASSIGNSTAT
+    const Level level{c};
+    const int p = c.expand(54);
+    switch (p) {
+    case 9:   // VARIABLE ASSIGNOP EXPR
+        nt_VARIABLE();
+        nt_ASSIGNOP();
+        nt_EXPR();
+        c.reduce(54, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(54, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_CLASSDECL() {
+    if (!c.enter(55)) return;   // CLASSDECL
+    const Level level{c};
+    const int p = c.expand(55);
+    switch (p) {
+    case 10:   // class id OPTCLASSDECL2 lcurbr REPTCLASSDECL4 rcurbr semi
+        c.match(45);   // class
+        c.match(3);   // id
+        nt_OPTCLASSDECL2();
+        c.match(17);   // lcurbr
+        nt_REPTCLASSDECL4();
+        c.match(16);   // rcurbr
+        c.match(6);   // semi
+        c.reduce(55, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(55, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_CLASSDECLORFUNCDEF() {
+    if (!c.enter(56)) return;   // CLASSDECLORFUNCDEF
+    const Level level{c};
+    const int p = c.expand(56);
+    switch (p) {
+    case 11:   // FUNCDEF
+        nt_FUNCDEF();
+        c.reduce(56, p);
+        break;
+    case 12:   // CLASSDECL
+        nt_CLASSDECL();
+        c.reduce(56, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(56, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_EXPR() {
+    if (!c.enter(57)) return;   // EXPR
+    const Level level{c};
+    const int p = c.expand(57);
+    switch (p) {
+    case 13:   // ARITHEXPR
+        nt_ARITHEXPR();
+        c.reduce(57, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(57, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FACTOR() {
+    if (!c.enter(58)) return;   // FACTOR
+    const Level level{c};
+    const int p = c.expand(58);
+    switch (p) {
+    case 14:   // VARIABLE
+        nt_VARIABLE();
+        c.reduce(58, p);
+        break;
+    case 15:   // lpar ARITHEXPR rpar
+        c.match(8);   // lpar
+        nt_ARITHEXPR();
+        c.match(7);   // rpar
+        c.reduce(58, p);
+        break;
+    case 16:   // SIGN FACTOR
+        nt_SIGN();
+        nt_FACTOR();
+        c.reduce(58, p);
+        break;
+    case 17:   // not FACTOR
+        c.match(42);   // not
+        nt_FACTOR();
+        c.reduce(58, p);
+        break;
+    case 18:   // floatlit
+        c.match(43);   // floatlit
+        c.reduce(58, p);
+        break;
+    case 19:   // intlit
+        c.match(44);   // intlit
+        c.reduce(58, p);
+        break;
+    case 82:   // FUNCTIONCALL
+        nt_FUNCTIONCALL();
+        c.reduce(58, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(58, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FPARAMS() {
+    if (!c.enter(59)) return;   // FPARAMS
+    const Level level{c};
+    const int p = c.expand(59);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(59, p);
+        break;
+    case 20:   // id colon TYPE REPTFPARAMS3 REPTFPARAMS4
+        c.match(3);   // id
+        c.match(33);   // colon
+        nt_TYPE();
+        nt_REPTFPARAMS3();
+        nt_REPTFPARAMS4();
+        c.reduce(59, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(59, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FPARAMSTAIL() {
+    if (!c.enter(60)) return;   // FPARAMSTAIL
+    const Level level{c};
+    const int p = c.expand(60);
+    switch (p) {
+    case 21:   // comma id colon TYPE REPTFPARAMSTAIL4
+        c.match(21);   // comma
+        c.match(3);   // id
+        c.match(33);   // colon
+        nt_TYPE();
+        nt_REPTFPARAMSTAIL4();
+        c.reduce(60, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(60, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FUNCBODY() {
+    if (!c.enter(61)) return;   // FUNCBODY
+    const Level level{c};
+    const int p = c.expand(61);
+    switch (p) {
+    case 22:   // lcurbr REPTFUNCBODY1 rcurbr
+        c.match(17);   // lcurbr
+        nt_REPTFUNCBODY1();
+        c.match(16);   // rcurbr
+        c.reduce(61, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(61, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FUNCDEF() {
+    if (!c.enter(62)) return;   // FUNCDEF
+    const Level level{c};
+    const int p = c.expand(62);
+    switch (p) {
+    case 23:   // FUNCHEAD FUNCBODY
+        nt_FUNCHEAD();
+        nt_FUNCBODY();
+        c.reduce(62, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(62, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FUNCHEAD() {
+    if (!c.enter(63)) return;   // FUNCHEAD
+    const Level level{c};
+    const int p = c.expand(63);
+    switch (p) {
+    case 24:   // function OPTFUNCHEAD1 id lpar FPARAMS rpar arrow RETURNTYPE
+        c.match(37);   // function
+        nt_OPTFUNCHEAD1();
+        c.match(3);   // id
+        c.match(8);   // lpar
+        nt_FPARAMS();
+        c.match(7);   // rpar
+        c.match(36);   // arrow
+        nt_RETURNTYPE();
+        c.reduce(63, p);
+        break;
+    case 90:   // function id sr constructor lpar FPARAMS rpar
+        c.match(37);   // function
+        c.match(3);   // id
+        c.match(28);   // sr
+        c.match(35);   // constructor
+        c.match(8);   // lpar
+        nt_FPARAMS();
+        c.match(7);   // rpar
+        c.reduce(63, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(63, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_FUNCTIONCALL() {
+    if (!c.enter(64)) return;   // FUNCTIONCALL
+    const Level level{c};
+    const int p = c.expand(64);
+    switch (p) {
+    case 25:   // REPTFUNCTIONCALL0 id lpar APARAMS rpar
+        nt_REPTFUNCTIONCALL0();
+        c.match(3);   // id
+        c.match(8);   // lpar
+        nt_APARAMS();
+        c.match(7);   // rpar
+        c.reduce(64, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(64, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_IDNEST() {
+    if (!c.enter(65)) return;   // IDNEST
+    const Level level{c};
+    const int p = c.expand(65);
+    switch (p) {
+    case 26:   // id REPTIDNEST1 dot
+        c.match(3);   // id
+        nt_REPTIDNEST1();
+        c.match(41);   // dot
+        c.reduce(65, p);
+        break;
+    case 87:   // dot id lpar APARAMS rpar
+        c.match(41);   // dot
+        c.match(3);   // id
+        c.match(8);   // lpar
+        nt_APARAMS();
+        c.match(7);   // rpar
+        c.reduce(65, p);
+        break;
+    case 88:   // dot id REPTIDNEST1
+        c.match(41);   // dot
+        c.match(3);   // id
+        nt_REPTIDNEST1();
+        c.reduce(65, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(65, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_INDICE() {
+    if (!c.enter(66)) return;   // INDICE
+    const Level level{c};
+    const int p = c.expand(66);
+    switch (p) {
+    case 27:   // lsqbr ARITHEXPR rsqbr
+        c.match(40);   // lsqbr
+        nt_ARITHEXPR();
+        c.match(39);   // rsqbr
+        c.reduce(66, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(66, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_LOCALVARDECL() {
+    if (!c.enter(67)) return;   // LOCALVARDECL
+    const Level level{c};
+    const int p = c.expand(67);
+    switch (p) {
+    case 28:   // localvar id colon TYPE REPTLOCALVARDECL4 semi
+        c.match(38);   // localvar
+        c.match(3);   // id
+        c.match(33);   // colon
+        nt_TYPE();
+        nt_REPTLOCALVARDECL4();
+        c.match(6);   // semi
+        c.reduce(67, p);
+        break;
+    case 89:   // localvar id colon TYPE lpar APARAMS rpar semi
+        c.match(38);   // localvar
+        c.match(3);   // id
+        c.match(33);   // colon
+        nt_TYPE();
+        c.match(8);   // lpar
+        nt_APARAMS();
+        c.match(7);   // rpar
+        c.match(6);   // semi
+        c.reduce(67, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(67, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_LOCALVARDECLORSTMT() {
+    if (!c.enter(68)) return;   // LOCALVARDECLORSTMT
+    const Level level{c};
+    const int p = c.expand(68);
+    switch (p) {
+    case 29:   // STATEMENT
+        nt_STATEMENT();
+        c.reduce(68, p);
+        break;
+    case 30:   // LOCALVARDECL
+        nt_LOCALVARDECL();
+        c.reduce(68, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(68, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_MEMBERDECL() {
+    if (!c.enter(69)) return;   // MEMBERDECL
+    const Level level{c};
+    const int p = c.expand(69);
+    switch (p) {
+    case 31:   // MEMBERVARDECL
+        nt_MEMBERVARDECL();
+        c.reduce(69, p);
+        break;
+    case 32:   // MEMBERFUNCDECL
+        nt_MEMBERFUNCDECL();
+        c.reduce(69, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(69, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_MEMBERFUNCDECL() {
+    if (!c.enter(70)) return;   // MEMBERFUNCDECL
+    const Level level{c};
+    const int p = c.expand(70);
+    switch (p) {
+    case 33:   // constructor colon lpar FPARAMS rpar semi
+        c.match(35);   // constructor
+        c.match(33);   // colon
+        c.match(8);   // lpar
+        nt_FPARAMS();
+        c.match(7);   // rpar
+        c.match(6);   // semi
+        c.reduce(70, p);
+        break;
+    case 34:   // function id colon lpar FPARAMS rpar arrow RETURNTYPE semi
+        c.match(37);   // function
+        c.match(3);   // id
+        c.match(33);   // colon
+        c.match(8);   // lpar
+        nt_FPARAMS();
+        c.match(7);   // rpar
+        c.match(36);   // arrow
+        nt_RETURNTYPE();
+        c.match(6);   // semi
+        c.reduce(70, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(70, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_MEMBERVARDECL() {
+    if (!c.enter(71)) return;   // MEMBERVARDECL
+    const Level level{c};
+    const int p = c.expand(71);
+    switch (p) {
+    case 35:   // attribute id colon TYPE REPTMEMBERVARDECL4 semi
+        c.match(34);   // attribute
+        c.match(3);   // id
+        c.match(33);   // colon
+        nt_TYPE();
+        nt_REPTMEMBERVARDECL4();
+        c.match(6);   // semi
+        c.reduce(71, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(71, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_MULTOP() {
+    if (!c.enter(72)) return;   // MULTOP
+    const Level level{c};
+    const int p = c.expand(72);
+    switch (p) {
+    case 36:   // and
+        c.match(30);   // and
+        c.reduce(72, p);
+        break;
+    case 37:   // div
+        c.match(31);   // div
+        c.reduce(72, p);
+        break;
+    case 38:   // mult
+        c.match(32);   // mult
+        c.reduce(72, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(72, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_OPTCLASSDECL2() {
+    if (!c.enter(73)) return;   // OPTCLASSDECL2
+    const Level level{c};
+    const int p = c.expand(73);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(73, p);
+        break;
+    case 39:   // isa id REPTOPTCLASSDECL22
+        c.match(29);   // isa
+        c.match(3);   // id
+        nt_REPTOPTCLASSDECL22();
+        c.reduce(73, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(73, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_OPTFUNCHEAD1() {
+    if (!c.enter(74)) return;   // OPTFUNCHEAD1
+    const Level level{c};
+    const int p = c.expand(74);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(74, p);
+        break;
+    case 40:   // id sr
+        c.match(3);   // id
+        c.match(28);   // sr
+        c.reduce(74, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(74, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_RELEXPR() {
+    if (!c.enter(75)) return;   // RELEXPR
+    const Level level{c};
+    const int p = c.expand(75);
+    switch (p) {
+    case 41:   // ARITHEXPR RELOP ARITHEXPR
+        nt_ARITHEXPR();
+        nt_RELOP();
+        nt_ARITHEXPR();
+        c.reduce(75, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(75, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_RELOP() {
+    if (!c.enter(76)) return;   // RELOP
+    const Level level{c};
+    const int p = c.expand(76);
+    switch (p) {
+    case 42:   // geq
+        c.match(22);   // geq
+        c.reduce(76, p);
+        break;
+    case 43:   // leq
+        c.match(23);   // leq
+        c.reduce(76, p);
+        break;
+    case 44:   // gt
+        c.match(24);   // gt
+        c.reduce(76, p);
+        break;
+    case 45:   // lt
+        c.match(25);   // lt
+        c.reduce(76, p);
+        break;
+    case 46:   // neq
+        c.match(26);   // neq
+        c.reduce(76, p);
+        break;
+    case 47:   // eq
+        c.match(27);   // eq
+        c.reduce(76, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(76, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTAPARAMS1() {
+    if (!c.enter(77)) return;   // REPTAPARAMS1
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(77)) == 48) {   // APARAMSTAIL REPTAPARAMS1
+        nt_APARAMSTAIL();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(77, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(77, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(77, 48);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTCLASSDECL4() {
+    if (!c.enter(78)) return;   // REPTCLASSDECL4
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(78)) == 49) {   // VISIBILITY MEMBERDECL REPTCLASSDECL4
+        nt_VISIBILITY();
+        nt_MEMBERDECL();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(78, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(78, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(78, 49);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTFPARAMS3() {
+    if (!c.enter(79)) return;   // REPTFPARAMS3
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(79)) == 50) {   // ARRAYSIZE REPTFPARAMS3
+        nt_ARRAYSIZE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(79, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(79, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(79, 50);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTFPARAMS4() {
+    if (!c.enter(80)) return;   // REPTFPARAMS4
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(80)) == 51) {   // FPARAMSTAIL REPTFPARAMS4
+        nt_FPARAMSTAIL();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(80, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(80, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(80, 51);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTFPARAMSTAIL4() {
+    if (!c.enter(81)) return;   // REPTFPARAMSTAIL4
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(81)) == 52) {   // ARRAYSIZE REPTFPARAMSTAIL4
+        nt_ARRAYSIZE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(81, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(81, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(81, 52);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTFUNCBODY1() {
+    if (!c.enter(82)) return;   // REPTFUNCBODY1
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(82)) == 53) {   // LOCALVARDECLORSTMT REPTFUNCBODY1
+        nt_LOCALVARDECLORSTMT();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(82, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(82, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(82, 53);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTFUNCTIONCALL0() {
+    if (!c.enter(83)) return;   // REPTFUNCTIONCALL0
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(83)) == 54) {   // IDNEST REPTFUNCTIONCALL0
+        nt_IDNEST();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(83, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(83, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(83, 54);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTIDNEST1() {
+    if (!c.enter(84)) return;   // REPTIDNEST1
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(84)) == 55) {   // INDICE REPTIDNEST1
+        nt_INDICE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(84, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(84, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(84, 55);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTLOCALVARDECL4() {
+    if (!c.enter(85)) return;   // REPTLOCALVARDECL4
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(85)) == 56) {   // ARRAYSIZE REPTLOCALVARDECL4
+        nt_ARRAYSIZE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(85, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(85, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(85, 56);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTMEMBERVARDECL4() {
+    if (!c.enter(86)) return;   // REPTMEMBERVARDECL4
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(86)) == 57) {   // ARRAYSIZE REPTMEMBERVARDECL4
+        nt_ARRAYSIZE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(86, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(86, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(86, 57);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTOPTCLASSDECL22() {
+    if (!c.enter(87)) return;   // REPTOPTCLASSDECL22
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(87)) == 58) {   // comma id REPTOPTCLASSDECL22
+        c.match(21);   // comma
+        c.match(3);   // id
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(87, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(87, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(87, 58);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTSTART0() {
+    if (!c.enter(88)) return;   // REPTSTART0
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(88)) == 59) {   // CLASSDECLORFUNCDEF REPTSTART0
+        nt_CLASSDECLORFUNCDEF();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(88, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(88, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(88, 59);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTSTATBLOCK1() {
+    if (!c.enter(89)) return;   // REPTSTATBLOCK1
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(89)) == 60) {   // STATEMENT REPTSTATBLOCK1
+        nt_STATEMENT();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(89, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(89, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(89, 60);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTVARIABLE0() {
+    if (!c.enter(90)) return;   // REPTVARIABLE0
+    const Level level{c};
+    const int p = c.expand(90);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(90, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(90, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_REPTVARIABLE2() {
+    if (!c.enter(91)) return;   // REPTVARIABLE2
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(91)) == 62) {   // INDICE REPTVARIABLE2
+        nt_INDICE();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(91, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(91, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(91, 62);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_RETURNTYPE() {
+    if (!c.enter(92)) return;   // RETURNTYPE
+    const Level level{c};
+    const int p = c.expand(92);
+    switch (p) {
+    case 63:   // TYPE
+        nt_TYPE();
+        c.reduce(92, p);
+        break;
+    case 64:   // void
+        c.match(20);   // void
+        c.reduce(92, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(92, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_RIGHTRECARITHEXPR() {
+    if (!c.enter(93)) return;   // RIGHTRECARITHEXPR
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(93)) == 65) {   // ADDOP TERM RIGHTRECARITHEXPR
+        nt_ADDOP();
+        nt_TERM();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(93, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(93, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(93, 65);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_RIGHTRECTERM() {
+    if (!c.enter(94)) return;   // RIGHTRECTERM
+    const Level level{c};
+    std::size_t items = 0;
+    int p;
+    while ((p = c.expand(94)) == 66) {   // MULTOP FACTOR RIGHTRECTERM
+        nt_MULTOP();
+        nt_FACTOR();
+        ++items;
+    }
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(94, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(94, p);
+        break;
+    }
+    for (; items > 0; --items) c.reduce(94, 66);
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_SIGN() {
+    if (!c.enter(95)) return;   // SIGN
+    const Level level{c};
+    const int p = c.expand(95);
+    switch (p) {
+    case 0:   // minus
+        c.match(18);   // minus
+        c.reduce(95, p);
+        break;
+    case 1:   // plus
+        c.match(19);   // plus
+        c.reduce(95, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(95, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_START() {
+    if (!c.enter(96)) return;   // START
+    const Level level{c};
+    const int p = c.expand(96);
+    switch (p) {
+    case 67:   // REPTSTART0
+        nt_REPTSTART0();
+        c.reduce(96, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(96, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_STATBLOCK() {
+    if (!c.enter(97)) return;   // STATBLOCK
+    const Level level{c};
+    const int p = c.expand(97);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(97, p);
+        break;
+    case 29:   // STATEMENT
+        nt_STATEMENT();
+        c.reduce(97, p);
+        break;
+    case 68:   // lcurbr REPTSTATBLOCK1 rcurbr
+        c.match(17);   // lcurbr
+        nt_REPTSTATBLOCK1();
+        c.match(16);   // rcurbr
+        c.reduce(97, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(97, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_STATEMENT() {
+    if (!c.enter(98)) return;   // STATEMENT
+    const Level level{c};
+    const int p = c.expand(98);
+    switch (p) {
+    case 69:   // ASSIGNSTAT semi
+        nt_ASSIGNSTAT();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 70:   // return lpar EXPR rpar semi
+        c.match(9);   // return
+        c.match(8);   // lpar
+        nt_EXPR();
+        c.match(7);   // rpar
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 71:   // write lpar EXPR rpar semi
+        c.match(10);   // write
+        c.match(8);   // lpar
+        nt_EXPR();
+        c.match(7);   // rpar
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 72:   // read lpar VARIABLE rpar semi
+        c.match(11);   // read
+        c.match(8);   // lpar
+        nt_VARIABLE();
+        c.match(7);   // rpar
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 73:   // while lpar RELEXPR rpar STATBLOCK semi
+        c.match(12);   // while
+        c.match(8);   // lpar
+        nt_RELEXPR();
+        c.match(7);   // rpar
+        nt_STATBLOCK();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 74:   // if lpar RELEXPR rpar then STATBLOCK else STATBLOCK semi
+        c.match(15);   // if
+        c.match(8);   // lpar
+        nt_RELEXPR();
+        c.match(7);   // rpar
+        c.match(14);   // then
+        nt_STATBLOCK();
+        c.match(13);   // else
+        nt_STATBLOCK();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 84:   // FUNCTIONCALL semi
+        nt_FUNCTIONCALL();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 85:   // id dot id equal EXPR semi
+        c.match(3);   // id
+        c.match(41);   // dot
+        c.match(3);   // id
+        c.match(46);   // equal
+        nt_EXPR();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    case 86:   // VARIABLE ASSIGNOP EXPR semi
+        nt_VARIABLE();
+        nt_ASSIGNOP();
+        nt_EXPR();
+        c.match(6);   // semi
+        c.reduce(98, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(98, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_TERM() {
+    if (!c.enter(99)) return;   // TERM
+    const Level level{c};
+    const int p = c.expand(99);
+    switch (p) {
+    case 75:   // FACTOR RIGHTRECTERM
+        nt_FACTOR();
+        nt_RIGHTRECTERM();
+        c.reduce(99, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(99, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_TYPE() {
+    if (!c.enter(100)) return;   // TYPE
+    const Level level{c};
+    const int p = c.expand(100);
+    switch (p) {
+    case 76:   // id
+        c.match(3);   // id
+        c.reduce(100, p);
+        break;
+    case 77:   // float
+        c.match(4);   // float
+        c.reduce(100, p);
+        break;
+    case 78:   // integer
+        c.match(5);   // integer
+        c.reduce(100, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(100, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_VARIABLE() {
+    if (!c.enter(101)) return;   // VARIABLE
+    const Level level{c};
+    const int p = c.expand(101);
+    switch (p) {
+    case 79:   // REPTVARIABLE0 id REPTVARIABLE2
+        nt_REPTVARIABLE0();
+        c.match(3);   // id
+        nt_REPTVARIABLE2();
+        c.reduce(101, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(101, p);
+        break;
+    }
+}
+
+template <typename Ctx>
+void Parser<Ctx>::nt_VISIBILITY() {
+    if (!c.enter(102)) return;   // VISIBILITY
+    const Level level{c};
+    const int p = c.expand(102);
+    switch (p) {
+    case 4:   // EPSILON
+        c.reduce(102, p);
+        break;
+    case 80:   // private
+        c.match(1);   // private
+        c.reduce(102, p);
+        break;
+    case 81:   // public
+        c.match(2);   // public
+        c.reduce(102, p);
+        break;
+    default:
+        if (p >= 0) c.unexpected(102, p);
+        break;
+    }
+}
+
+}  // namespace rd_parser
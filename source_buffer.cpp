@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: source_buffer.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#include "source_buffer.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SOURCE_BUFFER_MMAP 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <filesystem>
+#include <iterator>
+#include <system_error>
+#endif
+
+namespace io {
+
+namespace {
+
+std::runtime_error tooLarge(const std::string& path, std::uintmax_t size) {
+    return std::runtime_error(path + " is " + std::to_string(size) + " bytes; only --stream reads sources over " +
+                              std::to_string(kMaxSourceBytes) + " bytes");
+}
+
+}  // namespace
+
+#if defined(SOURCE_BUFFER_MMAP)
+
+namespace {
+
+struct FdCloser {
+    int fd;
+    ~FdCloser() {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+};
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+}
+
+}  // namespace
+
+SourceBuffer SourceBuffer::open(const std::string& path) {
+    FdCloser file{::open(path.c_str(), O_RDONLY)};
+    if (file.fd < 0) {
+        throw ioError("Cannot open", path);
+    }
+
+    SourceBuffer buffer;
+    struct stat st {};
+    if (::fstat(file.fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        if (static_cast<std::uintmax_t>(st.st_size) > kMaxSourceBytes) {
+            throw tooLarge(path, static_cast<std::uintmax_t>(st.st_size));
+        }
+        const auto length = static_cast<std::size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file.fd, 0);
+        if (addr != MAP_FAILED) {
+            ::madvise(addr, length, MADV_SEQUENTIAL);
+            buffer.mapped = static_cast<const char*>(addr);
+            buffer.mappedSize = length;
+            return buffer;
+        }
+        // Fall through to read(): some filesystems refuse mmap.
+    }
+
+    // Pipes, character devices, empty/procfs files: read until EOF.
+    char chunk[1 << 16];
+    while (true) {
+        const ssize_t got = ::read(file.fd, chunk, sizeof(chunk));
+        if (got > 0) {
+            if (buffer.owned.size() + static_cast<std::size_t>(got) > kMaxSourceBytes) {
+                throw tooLarge(path, buffer.owned.size() + static_cast<std::size_t>(got));
+            }
+            buffer.owned.append(chunk, static_cast<std::size_t>(got));
+        } else if (got == 0) {
+            break;
+        } else if (errno != EINTR) {
+            throw ioError("Cannot read", path);
+        }
+    }
+    return buffer;
+}
+
+void SourceBuffer::release() noexcept {
+    if (mapped) {
+        ::munmap(const_cast<char*>(mapped), mappedSize);
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+    owned.clear();
+}
+
+#else
+
+SourceBuffer SourceBuffer::open(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    std::error_code ec;
+    const std::uintmax_t size = std::filesystem::file_size(path, ec);
+    if (!ec && size > kMaxSourceBytes) {
+        throw tooLarge(path, size);
+    }
+    SourceBuffer buffer;
+    buffer.owned.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return buffer;
+}
+
+void SourceBuffer::release() noexcept {
+    mapped = nullptr;
+    mappedSize = 0;
+    owned.clear();
+}
+
+#endif
+
+SourceBuffer::~SourceBuffer() {
+    release();
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept
+    : mapped(other.mapped), mappedSize(other.mappedSize), owned(std::move(other.owned)) {
+    other.mapped = nullptr;
+    other.mappedSize = 0;
+}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapped = other.mapped;
+        mappedSize = other.mappedSize;
+        owned = std::move(other.owned);
+        other.mapped = nullptr;
+        other.mappedSize = 0;
+    }
+    return *this;
+}
+
+SourceWindow SourceWindow::open(const std::string& path, std::size_t capacity) {
+    SourceWindow window;
+    window.path = path;
+    window.in.open(path, std::ios::binary);
+    if (!window.in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    if (capacity > kMaxSourceBytes) {
+        throw std::runtime_error("Cannot stream " + path + ": a window of " + std::to_string(capacity) +
+                                 " bytes is over " + std::to_string(kMaxSourceBytes));
+    }
+    window.buffer.resize(capacity > 0 ? capacity : 1);
+    window.refill(0);
+    return window;
+}
+
+std::size_t SourceWindow::refill(std::size_t keepFrom) {
+    if (keepFrom > 0) {
+        std::memmove(buffer.data(), buffer.data() + keepFrom, filled - keepFrom);
+        filled -= keepFrom;
+    } else if (filled == buffer.size()) {
+        if (buffer.size() > kMaxSourceBytes / 2) {
+            throw std::runtime_error("Cannot stream " + path + ": one token or lookahead needs over " +
+                                     std::to_string(kMaxSourceBytes) + " bytes");
+        }
+        buffer.resize(buffer.size() * 2);
+    }
+    while (!eof && filled < buffer.size()) {
+        in.read(buffer.data() + filled, static_cast<std::streamsize>(buffer.size() - filled));
+        const auto got = static_cast<std::size_t>(in.gcount());
+        filled += got;
+        totalRead += got;
+        if (!in) {
+            if (!in.eof()) {
+                throw std::runtime_error("Cannot read " + path);
+            }
+            eof = true;
+        }
+    }
+    return keepFrom;
+}
+
+}  // namespace io
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: source_buffer.hpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace io {
+
+// Largest file SourceBuffer::open accepts. Token offsets and lengths and
+// the LineIndex are 32-bit; --stream's are relative to its window, so it
+// takes larger files as long as the window stays within this.
+inline constexpr std::size_t kMaxSourceBytes = UINT32_MAX;
+
+// Read-only bytes of a source file. Regular files are memory-mapped (with
+// MADV_SEQUENTIAL, since the lexer makes one forward pass); pipes, special
+// files and platforms without mmap are read into an owned string instead.
+class SourceBuffer {
+public:
+    // Throws std::runtime_error if the file cannot be opened or read, or
+    // is larger than kMaxSourceBytes.
+    static SourceBuffer open(const std::string& path);
+
+    SourceBuffer() = default;
+    ~SourceBuffer();
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+    SourceBuffer(SourceBuffer&& other) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& other) noexcept;
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        return mapped ? std::string_view(mapped, mappedSize) : std::string_view(owned);
+    }
+    [[nodiscard]] std::size_t size() const noexcept { return view().size(); }
+    [[nodiscard]] bool isMapped() const noexcept { return mapped != nullptr; }
+
+private:
+    void release() noexcept;
+
+    const char* mapped{nullptr};
+    std::size_t mappedSize{0};
+    std::string owned;
+};
+
+// Fixed-size sliding window over a file for --stream, so inputs far larger
+// than memory can be lexed. The window only grows when the bytes the
+// caller still needs (one token, or the lookahead tokens) outgrow it.
+class SourceWindow {
+public:
+    // Throws std::runtime_error if the file cannot be opened or read.
+    static SourceWindow open(const std::string& path, std::size_t capacity);
+
+    [[nodiscard]] std::string_view view() const noexcept {
+        return std::string_view(buffer.data(), filled);
+    }
+    // True once view() reaches the end of the file.
+    [[nodiscard]] bool atEof() const noexcept { return eof; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return buffer.size(); }
+    [[nodiscard]] std::uint64_t bytesRead() const noexcept { return totalRead; }
+
+    // Drops view()[0, keepFrom), slides the rest to the front and reads more
+    // input behind it. Returns keepFrom, the amount every window-relative
+    // offset held by the caller must be reduced by. Throws
+    // std::runtime_error if the window would outgrow kMaxSourceBytes.
+    std::size_t refill(std::size_t keepFrom);
+
+private:
+    std::string path;
+    std::ifstream in;
+    std::vector<char> buffer;
+    std::size_t filled{0};
+    std::uint64_t totalRead{0};
+    bool eof{false};
+};
+
+}  // namespace io
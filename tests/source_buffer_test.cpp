@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: source_buffer_test.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Checks the size guard of io::SourceBuffer: a file of kMaxSourceBytes
+// opens, one byte more is refused with a message pointing at --stream.
+// Token offsets are 32-bit, so a larger file would otherwise lex with
+// wrapped offsets. The files are sparse, so nothing is written or read.
+// Exits 1 on the first failure.
+//
+//   g++ -std=c++17 -O2 tests/source_buffer_test.cpp source_buffer.cpp -o source_buffer_test
+//   ./source_buffer_test [scratch-dir]
+
+#include "../source_buffer.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const string& what) {
+    cout << (ok ? "[PASS] " : "[FAIL] ") << what << "\n";
+    if (!ok) {
+        ++failures;
+    }
+}
+
+// A sparse file of `size` bytes.
+string makeFile(const filesystem::path& dir, const string& name, uintmax_t size) {
+    const filesystem::path path = dir / name;
+    ofstream(path, ios::binary | ios::trunc).close();
+    filesystem::resize_file(path, size);
+    return path.string();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const filesystem::path dir = argc > 1 ? filesystem::path(argv[1]) : filesystem::temp_directory_path();
+
+    const string small = makeFile(dir, "source_buffer_test_small.src", 16);
+    try {
+        check(io::SourceBuffer::open(small).size() == 16, "a 16-byte file opens whole");
+    } catch (const exception& ex) {
+        check(false, string("a 16-byte file opens: ") + ex.what());
+    }
+
+    const string limit = makeFile(dir, "source_buffer_test_limit.src", io::kMaxSourceBytes);
+    try {
+        const io::SourceBuffer buffer = io::SourceBuffer::open(limit);
+        check(buffer.size() == io::kMaxSourceBytes, "a file of kMaxSourceBytes opens whole");
+    } catch (const exception& ex) {
+        check(false, string("a file of kMaxSourceBytes opens: ") + ex.what());
+    }
+
+    const string over = makeFile(dir, "source_buffer_test_over.src", uintmax_t(io::kMaxSourceBytes) + 1);
+    try {
+        io::SourceBuffer::open(over);
+        check(false, "a file over kMaxSourceBytes is refused");
+    } catch (const runtime_error& ex) {
+        const string message = ex.what();
+        check(message.find("--stream") != string::npos && message.find(over) != string::npos,
+              "a file over kMaxSourceBytes is refused: " + message);
+    }
+
+    for (const string& path : {small, limit, over}) {
+        filesystem::remove(path);
+    }
+    return failures == 0 ? 0 : 1;
+}
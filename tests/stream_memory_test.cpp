@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: stream_memory_test.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Checks that --stream keeps a flat peak memory over runs that no token
+// needs: 128 MB of spaces, of newlines, a nested block comment, a line
+// comment and an unterminated comment, each between two copies of a test
+// program. Runs the parser on each with --stream=65536 --emit=ast,errors
+// and fails if its peak RSS reaches kLimitMb. Exits 1 on the first failure.
+// POSIX only (fork/exec, wait4).
+//
+//   g++ -std=c++17 -O2 tests/stream_memory_test.cpp -o stream_memory_test
+//   ./stream_memory_test ./parser [scratch-dir]
+
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+constexpr size_t kRunBytes = size_t(128) << 20;
+constexpr long kLimitMb = 32;
+
+int failures = 0;
+
+// `program`, `run` repeated up to kRunBytes, then `program` again.
+void writeSource(const filesystem::path& path, const string& program, const string& open, const string& run,
+                 const string& close) {
+    ofstream out(path, ios::binary | ios::trunc);
+    out << program << open;
+    string block;
+    while (block.size() < (size_t(1) << 20)) {
+        block += run;
+    }
+    for (size_t written = 0; written < kRunBytes; written += block.size()) {
+        out << block;
+    }
+    out << close << program;
+}
+
+// Runs the parser on `source`; its peak RSS in MB, or -1 if it did not
+// exit normally.
+long peakRssMb(const string& parser, const filesystem::path& dir, const filesystem::path& source) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        if (chdir(dir.c_str()) != 0) {
+            _exit(127);
+        }
+        const int null = ::open("/dev/null", O_WRONLY);
+        dup2(null, STDOUT_FILENO);
+        dup2(null, STDERR_FILENO);
+        execl(parser.c_str(), parser.c_str(), "--stream=65536", "--emit=ast,errors", source.c_str(),
+              static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    int status = 0;
+    struct rusage usage {};
+    if (pid < 0 || wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) == 127) {
+        return -1;
+    }
+#if defined(__APPLE__)
+    return usage.ru_maxrss / (1024 * 1024);   // bytes
+#else
+    return usage.ru_maxrss / 1024;            // KB
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        cerr << "Usage: ./stream_memory_test <parser> [scratch-dir]\n";
+        return 1;
+    }
+    const string parser = filesystem::absolute(argv[1]).string();
+    const filesystem::path dir =
+        (argc > 2 ? filesystem::path(argv[2]) : filesystem::temp_directory_path()) / "stream_memory_test";
+    filesystem::create_directories(dir);
+
+    ifstream in(filesystem::path(argv[0]).parent_path() / "test-files/test-6.17-complex-expressions.src");
+    const string program = in ? string(istreambuf_iterator<char>(in), istreambuf_iterator<char>())
+                              : string("function main() => void { localvar a: integer; a = 1; }\n");
+
+    struct Case {
+        const char* name;
+        string open, run, close;
+    };
+    const vector<Case> cases = {
+        {"spaces", "", " ", ""},
+        {"newlines", "", "\n", ""},
+        {"block-comment", "/*", "x /* y */\n", "*/\n"},
+        {"line-comment", "//", "x", "\n"},
+        {"unterminated-comment", "/*", "x\n", "/*"},
+    };
+    for (const Case& c : cases) {
+        const filesystem::path source = dir / (string(c.name) + ".src");
+        writeSource(source, program, c.open, c.run, c.close);
+        const long mb = peakRssMb(parser, dir, source);
+        const bool ok = mb >= 0 && mb < kLimitMb;
+        cout << (ok ? "[PASS] " : "[FAIL] ") << c.name << ": peak RSS " << mb << " MB over a "
+             << (kRunBytes >> 20) << " MB run (limit " << kLimitMb << " MB)\n";
+        if (!ok) {
+            ++failures;
+        }
+        filesystem::remove(source);
+    }
+    filesystem::remove_all(dir);
+    return failures == 0 ? 0 : 1;
+}
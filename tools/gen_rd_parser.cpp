@@ -0,0 +1,203 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: gen_rd_parser.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Generates rd_parser_generated.hpp, the recursive-descent engine behind
+// --engine=rd: one function per nonterminal with a case per production the
+// driver's decisions (table cells plus the lookahead DFAs in
+// parser_decisions.cpp) can choose. The first operator level's function
+// hands the expression to the driver's precedence-climbing parser, and
+// right-recursive lists loop over their items. Every function enters and
+// leaves a level through the driver, which bounds the nesting. Rerun it
+// whenever the table or the decisions change; the driver refuses a stale
+// header by its fingerprint.
+//
+//   g++ -std=c++17 -O2 tools/gen_rd_parser.cpp parser_decisions.cpp ll1_generator.cpp parse_table.cpp source_buffer.cpp -o gen_rd_parser
+//   ./gen_rd_parser grammar/parsing_table.csv rd_parser_generated.hpp
+
+#include "../ll1_generator.hpp"
+#include "../parse_table.hpp"
+#include "../parser_decisions.hpp"
+
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+string functionName(string_view nonterm) {
+    string out = "nt_";
+    for (unsigned char c : nonterm) out += isalnum(c) ? static_cast<char>(c) : '_';
+    return out;
+}
+
+string rhsComment(const Table& T, int prod) {
+    string out;
+    for (const string_view sym : T.rhs(prod)) (out += (out.empty() ? "" : " ")) += sym;
+    return out;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        cerr << "Usage: ./gen_rd_parser <parsing_table.csv|.tbl|grammar.grm> <out.hpp>\n";
+        return 1;
+    }
+    Table PT;
+    ParserSymbols N;
+    try {
+        const bool grammar = filesystem::path(argv[1]).extension() == ".grm";
+        PT = grammar ? loadGrammarTable(argv[1]) : loadTable(argv[1]);
+        N = prepareParserSymbols(PT, "START");
+    } catch (const exception& ex) {
+        cerr << "Failed to load parsing table: " << ex.what() << "\n";
+        return 1;
+    }
+    if (!PT.isNonterminal(N.start)) {
+        cerr << "Parsing table " << argv[1] << " has no START row\n";
+        return 1;
+    }
+
+    const int first = PT.termCount, last = PT.termCount + PT.nontermCount;
+    ostringstream decls, defs;
+    size_t cases = 0, loops = 0;
+    // Emits production `prod`'s symbols, leaving out the last `drop`.
+    auto emitSymbols = [&](int prod, int drop) {
+        for (int k = 0; k + drop < PT.rhsLength(prod); ++k) {
+            const int sym = PT.rhsSymbol(prod, k);
+            if (sym == PT.ids.eof) {
+                return false;
+            }
+            if (PT.isNonterminal(sym)) {
+                defs << "        " << functionName(PT.symbols[static_cast<size_t>(sym)]) << "();\n";
+            } else {
+                defs << "        c.match(" << sym << ");   // " << PT.symbols[static_cast<size_t>(sym)] << "\n";
+            }
+        }
+        return true;
+    };
+    for (int X = first; X < last; ++X) {
+        const string name(PT.symbols[static_cast<size_t>(X)]);
+        const string fn = functionName(name);
+        decls << "    void " << fn << "();\n";
+        defs << "template <typename Ctx>\n"
+             << "void Parser<Ctx>::" << fn << "() {\n"
+             << "    if (!c.enter(" << X << ")) return;   // " << name << "\n"
+             << "    const Level level{c};\n";
+        if (!N.exprLevels.empty() && X == N.exprLevels.front().head) {
+            defs << "    if (c.expression([this] { "
+                 << functionName(PT.symbols[static_cast<size_t>(N.exprOperand)]) << "(); })) return;\n";
+        }
+        // A list (X -> items X | ...) with one right-recursive production
+        // loops over its items instead of recursing once per item; the
+        // reductions the recursion would have made run afterwards,
+        // innermost first.
+        const vector<int> choices = expansionChoices(PT, N, X);
+        int tail = -1;
+        for (int prod : choices) {
+            const int length = PT.rhsLength(prod);
+            if (length > 0 && PT.rhsSymbol(prod, length - 1) == X) {
+                tail = (tail == -1) ? prod : -2;
+            }
+        }
+        if (tail >= 0) {
+            ++loops;
+            ++cases;
+            defs << "    std::size_t items = 0;\n"
+                 << "    int p;\n"
+                 << "    while ((p = c.expand(" << X << ")) == " << tail << ") {   // " << rhsComment(PT, tail) << "\n";
+            if (!emitSymbols(tail, 1)) {
+                cerr << "Production " << tail << " of " << name << " contains the end marker\n";
+                return 1;
+            }
+            defs << "        ++items;\n"
+                 << "    }\n";
+        } else {
+            defs << "    const int p = c.expand(" << X << ");\n";
+        }
+        defs << "    switch (p) {\n";
+        for (int prod : choices) {
+            if (prod == tail) {
+                continue;
+            }
+            ++cases;
+            defs << "    case " << prod << ":   // " << rhsComment(PT, prod) << "\n";
+            if (!emitSymbols(prod, 0)) {
+                cerr << "Production " << prod << " of " << name << " contains the end marker\n";
+                return 1;
+            }
+            defs << "        c.reduce(" << X << ", p);\n"
+                 << "        break;\n";
+        }
+        defs << "    default:\n"
+             << "        if (p >= 0) c.unexpected(" << X << ", p);\n"
+             << "        break;\n"
+             << "    }\n";
+        if (tail >= 0) {
+            defs << "    for (; items > 0; --items) c.reduce(" << X << ", " << tail << ");\n";
+        }
+        defs << "}\n\n";
+    }
+
+    ofstream out(argv[2], ios::trunc);
+    out << "// Generated by tools/gen_rd_parser.cpp from " << argv[1] << ".\n"
+        << "// Do not edit; rerun the generator after changing the table or the\n"
+        << "// lookahead decisions in parser_decisions.cpp.\n\n"
+        << "#pragma once\n\n"
+        << "#include <cstddef>\n"
+        << "#include <cstdint>\n\n"
+        << "namespace rd_parser {\n\n"
+        << "// decisionFingerprint of the table and decisions this was generated from.\n"
+        << "inline constexpr std::uint64_t kFingerprint = 0x" << hex << setw(16) << setfill('0')
+        << decisionFingerprint(PT, N) << dec << "ull;\n\n"
+        << "// One function per nonterminal. Ctx supplies the driver's steps:\n"
+        << "//   bool enter(int X)              X's function is starting; false to\n"
+        << "//                                  return at once, X's value supplied\n"
+        << "//   void leave()                   an entered function is returning\n"
+        << "//   int expand(int X)              production chosen for X (logged), or -1\n"
+        << "//                                  once \"no rule\" has been reported\n"
+        << "//   void match(int a)              terminal a\n"
+        << "//   void reduce(int X, int p)      X's semantic action for production p\n"
+        << "//   void unexpected(int X, int p)  p is not a production X was generated for\n"
+        << "//   bool expression(F operand)     parse the operator levels below here,\n"
+        << "//                                  calling operand() for each operand;\n"
+        << "//                                  false to have this function do it\n"
+        << "template <typename Ctx>\n"
+        << "class Parser {\n"
+        << "public:\n"
+        << "    explicit Parser(Ctx& ctx) : c(ctx) {}\n\n"
+        << "    void parse() { " << functionName(PT.symbols[static_cast<size_t>(N.start)]) << "(); }\n\n"
+        << "private:\n"
+        << "    // Leaves the function it was made in on every return.\n"
+        << "    struct Level {\n"
+        << "        Ctx& c;\n"
+        << "        ~Level() { c.leave(); }\n"
+        << "    };\n\n"
+        << "    Ctx& c;\n\n"
+        << decls.str() << "};\n\n"
+        << defs.str() << "}  // namespace rd_parser\n";
+    if (!out) {
+        cerr << "Cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    cout << "[OK]   " << argv[1] << " -> " << argv[2] << " (" << PT.nontermCount << " functions, " << cases
+         << " cases, " << loops << " list loops)\n";
+    return 0;
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: gen_table_header.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Generates parse_table_data.hpp, the LL(1) table the parser embeds, from
+// the CSV, a compiled .tbl, or a .grm grammar (built with ll1_generator).
+// It writes the table's image (see "Table image" in parse_table.hpp) after
+// prepareParserSymbols, as --compile-table does, so the parser points at
+// the arrays as they are. Rerun it whenever the table changes:
+//
+//   g++ -std=c++17 -O2 tools/gen_table_header.cpp parser_decisions.cpp ll1_generator.cpp parse_table.cpp source_buffer.cpp -o gen_table_header
+//   ./gen_table_header grammar/parsing_table.csv parse_table_data.hpp
+
+#include "../ll1_generator.hpp"
+#include "../parse_table.hpp"
+#include "../parser_decisions.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+template <typename T>
+void writeArray(ostream& out, const char* type, const char* name, const T* values, size_t count,
+                bool hex = false) {
+    out << "inline constexpr " << type << ' ' << name << "[] = {";
+    const size_t perLine = hex ? 6 : 12;
+    for (size_t k = 0; k < count; ++k) {
+        out << (k % perLine == 0 ? "\n    " : " ");
+        if (hex) {
+            char word[16];
+            snprintf(word, sizeof(word), "0x%08X", static_cast<unsigned>(values[k]));
+            out << word << ',';
+        } else {
+            out << values[k] << ',';
+        }
+    }
+    out << "\n};\n\n";
+}
+
+string cLiteral(const string& bytes) {
+    string out = "\"";
+    for (unsigned char c : bytes) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        } else if (c < 0x20 || c >= 0x7f) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\%03o", c);
+            out += esc;
+        } else {
+            out += static_cast<char>(c);
+        }
+    }
+    return out + "\"";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        cerr << "Usage: ./gen_table_header <parsing_table.csv|.tbl|grammar.grm> <out.hpp>\n";
+        return 1;
+    }
+    Table T;
+    try {
+        const bool grammar = filesystem::path(argv[1]).extension() == ".grm";
+        T = grammar ? loadGrammarTable(argv[1]) : loadTable(argv[1]);
+        prepareParserSymbols(T, "START");
+    } catch (const exception& ex) {
+        cerr << "Failed to load parsing table: " << ex.what() << "\n";
+        return 1;
+    }
+    if (T.termCount == 0 || T.nontermCount == 0 || T.prodEntries.empty()) {
+        cerr << "Parsing table " << argv[1] << " is empty\n";
+        return 1;
+    }
+    vector<uint32_t> symbolStart;
+    string pool;
+    const TableImage img = tableImage(T, symbolStart, pool);
+
+    ofstream out(argv[2], ios::trunc);
+    out << "// Generated by tools/gen_table_header.cpp from " << argv[1] << ".\n"
+        << "// Do not edit; rerun the generator after changing the table.\n"
+        << "// Layout: see \"Table image\" in parse_table.hpp.\n\n"
+        << "#pragma once\n\n"
+        << "#include <cstdint>\n\n"
+        << "namespace embedded_table {\n\n"
+        << "inline constexpr char kSource[] = " << cLiteral(argv[1]) << ";\n\n"
+        << "inline constexpr std::uint32_t kTermCount = " << img.termCount << ";\n"
+        << "inline constexpr std::uint32_t kNontermCount = " << img.nontermCount << ";\n\n";
+    writeArray(out, "std::uint32_t", "kSymbolStart", img.symbolStart, size_t(img.symbolCount) + 1);
+    writeArray(out, "std::uint32_t", "kProdStart", img.prodStart, size_t(img.productionCount) + 1);
+    writeArray(out, "std::uint32_t", "kProdEntries", img.prodEntries, img.entryCount, true);
+    writeArray(out, "std::int32_t", "kCombBase", img.cells.base, img.cells.rows);
+    writeArray(out, "std::int16_t", "kCombDefault", img.cells.rowDefault, img.cells.rows);
+    writeArray(out, "std::int16_t", "kCombProd", img.cells.entryProd, img.cells.slots);
+    writeArray(out, "std::int16_t", "kCombRow", img.cells.entryRow, img.cells.slots);
+    out << "inline constexpr char kPool[] =";
+    for (size_t k = 1; k < symbolStart.size(); ++k) {
+        const size_t from = symbolStart[k - 1];
+        out << (k % 8 == 1 ? "\n    " : " ") << cLiteral(pool.substr(from, symbolStart[k] - from));
+    }
+    out << ";\n\n}  // namespace embedded_table\n";
+    if (!out) {
+        cerr << "Cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    cout << "[OK]   " << argv[1] << " -> " << argv[2] << " (" << T.nontermCount << " x " << T.termCount
+         << " cells in " << img.cells.slots << " slots, " << T.productionCount() << " productions)\n";
+    return 0;
+}
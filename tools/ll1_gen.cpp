@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////
+// File Name: ll1_gen.cpp
+// Group Number: 2
+// Group Members Names: Mirac Ozcan, Sidhant Sharma, Arvin, Paschal
+// Group Members Seneca Email: mozkan1@myseneca.ca, ssharma471@myseneca.ca, aarmand1@myseneca.ca, Pibeh@myseneca.ca
+// Date: October 17, 2026
+// Authenticity Declaration:
+// I declare this submission is the result of our group work and has not
+// been shared with any other groups/students or 3rd party content provider.
+///////////////////////////////////////////////////////////////////////////
+
+// Builds the LL(1) table from a .grm grammar: computes FIRST/FOLLOW,
+// reports conflicts, optionally checks the sets against grammartool's
+// listings and a table against an existing one, and writes a compiled
+// .tbl. gen_table_header also accepts a .grm directly.
+//
+//   g++ -std=c++17 -O2 tools/ll1_gen.cpp ll1_generator.cpp parse_table.cpp source_buffer.cpp -o ll1_gen
+//   ./ll1_gen grammar/grammar_nolr.grm --first=grammar/grammar_LL1.grm.first --follow=grammar/grammar_LL1.grm.follow --diff=grammar/parsing_table.csv --out=table.tbl
+
+#include "../ll1_generator.hpp"
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+string rhsText(const Table& T, int prod) {
+    if (prod < 0) return "(none)";
+    string out;
+    for (const string_view sym : T.rhs(prod)) (out += (out.empty() ? "" : " ")) += sym;
+    return out;
+}
+
+// Cells that differ between `ours` and `other`, matched by symbol name.
+int diffTables(const Table& ours, const Table& other) {
+    int diffs = 0;
+    for (int i = 0; i < other.nontermCount; ++i) {
+        const string_view A = other.symbols[static_cast<size_t>(other.termCount + i)];
+        if (nontermIndex(ours, A) < 0) {
+            cout << "  " << A << ": not in the grammar\n";
+            ++diffs;
+            continue;
+        }
+        for (int a = 0; a < other.termCount; ++a) {
+            const string_view t = other.symbols[static_cast<size_t>(a)];
+            const int col = termIndex(ours, t);
+            const string theirs = rhsText(other, other.predict(other.termCount + i, a));
+            const string mine = col < 0 ? "(no column)" : rhsText(ours, ours.predict(ours.symbolId(A), col));
+            if (mine != theirs) {
+                cout << "  " << A << " on " << t << ": generated " << mine << ", table " << theirs << "\n";
+                ++diffs;
+            }
+        }
+    }
+    return diffs;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    string grammarPath, firstPath, followPath, diffPath, outPath;
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg.rfind("--first=", 0) == 0) {
+            firstPath = arg.substr(8);
+        } else if (arg.rfind("--follow=", 0) == 0) {
+            followPath = arg.substr(9);
+        } else if (arg.rfind("--diff=", 0) == 0) {
+            diffPath = arg.substr(7);
+        } else if (arg.rfind("--out=", 0) == 0) {
+            outPath = arg.substr(6);
+        } else if (grammarPath.empty() && arg.rfind("--", 0) != 0) {
+            grammarPath = arg;
+        } else {
+            grammarPath.clear();
+            break;
+        }
+    }
+    if (grammarPath.empty() || firstPath.empty() != followPath.empty()) {
+        cerr << "Usage: ./ll1_gen <grammar.grm> [--first=<file> --follow=<file>] [--diff=<table.csv|.tbl>] "
+                "[--out=<table.tbl>]\n";
+        return 1;
+    }
+
+    int status = 0;
+    try {
+        const auto t0 = chrono::steady_clock::now();
+        const Grammar G = loadGrammar(grammarPath);
+        const LL1Analysis L = analyzeLL1(G);
+        const Table T = tableFromGrammar(G, L);
+        const auto t1 = chrono::steady_clock::now();
+
+        cout << "[OK]   " << grammarPath << ": " << G.nonterms.size() << " nonterminals, "
+             << G.terms.size() << " terminals, " << G.productions.size() << " productions, "
+             << L.passes << " fixpoint passes, "
+             << chrono::duration<double, milli>(t1 - t0).count() << " ms\n";
+        if (!L.conflicts.empty()) {
+            cout << "[WARN] " << L.conflicts.size() << " LL(1) conflict(s); the first production is kept:\n";
+            for (const auto& c : L.conflicts) cout << "  " << describeConflict(G, c) << "\n";
+        }
+
+        if (!firstPath.empty()) {
+            const vector<string> diffs = compareFirstFollow(G, L, firstPath, followPath);
+            if (diffs.empty()) {
+                cout << "[OK]   FIRST/FOLLOW match " << firstPath << " and " << followPath << "\n";
+            } else {
+                cout << "[FAIL] " << diffs.size() << " FIRST/FOLLOW difference(s):\n";
+                for (const auto& d : diffs) cout << "  " << d << "\n";
+                status = 2;
+            }
+        }
+        if (!diffPath.empty()) {
+            const int diffs = diffTables(T, loadTable(diffPath));
+            cout << (diffs ? "[DIFF] " : "[OK]   ") << diffs << " cell(s) differ from " << diffPath << "\n";
+        }
+        if (!outPath.empty()) {
+            writeCompiledTable(T, outPath);
+            cout << "[OK]   " << grammarPath << " -> " << outPath << "\n";
+        }
+    } catch (const exception& ex) {
+        cerr << "ll1_gen: " << ex.what() << "\n";
+        return 1;
+    }
+    return status;
+}